@@ -0,0 +1,128 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdalign.h>
+#include <stddef.h>
+
+#include "NodePool.h"
+
+// Each slab is one allocation holding a header followed by node space
+#define SLAB_BYTES (64 * 1024)
+
+#define NODE_ALIGN alignof(max_align_t)
+
+// Slabs stay on a singly linked list in allocation order, so a reset can
+// rewind to the first slab and bump through the existing slabs again
+// before allocating new ones.
+struct slab {
+    alignas(max_align_t) struct slab *next;
+};
+
+#define SLAB_HEADER \
+    ((sizeof(struct slab) + NODE_ALIGN - 1) / NODE_ALIGN * NODE_ALIGN)
+
+// A released node stores the link to the next free node in its own memory
+struct freeNode {
+    struct freeNode *next;
+};
+
+struct nodePool {
+    size_t nodeSize;
+    size_t nodesPerSlab;
+    struct slab *first;
+    struct slab *last;
+    struct slab *curr;      // slab being bump allocated from, or NULL
+    size_t used;            // nodes handed out of curr so far
+    struct freeNode *free;
+    size_t live;
+};
+
+static struct slab *newSlab(void) {
+    struct slab *s = malloc(SLAB_BYTES);
+    if (s == NULL) {
+        printf("Memory allocation failed\n");
+        exit(1);
+    }
+    s->next = NULL;
+    return s;
+}
+
+NodePool NodePoolNew(size_t nodeSize) {
+    if (nodeSize < sizeof(struct freeNode)) {
+        nodeSize = sizeof(struct freeNode);
+    }
+    nodeSize = (nodeSize + NODE_ALIGN - 1) / NODE_ALIGN * NODE_ALIGN;
+    if (nodeSize > SLAB_BYTES - SLAB_HEADER) {
+        fprintf(stderr, "NodePoolNew: node size %zu exceeds slab size\n",
+                nodeSize);
+        exit(1);
+    }
+
+    NodePool p = malloc(sizeof(struct nodePool));
+    if (p == NULL) {
+        printf("Memory allocation failed\n");
+        exit(1);
+    }
+    p->nodeSize = nodeSize;
+    p->nodesPerSlab = (SLAB_BYTES - SLAB_HEADER) / nodeSize;
+    p->first = NULL;
+    p->last = NULL;
+    p->curr = NULL;
+    p->used = 0;
+    p->free = NULL;
+    p->live = 0;
+    return p;
+}
+
+void NodePoolFree(NodePool p) {
+    struct slab *s = p->first;
+    while (s != NULL) {
+        struct slab *del = s;
+        s = s->next;
+        free(del);
+    }
+    free(p);
+}
+
+void *NodePoolAlloc(NodePool p) {
+    p->live++;
+    if (p->free != NULL) {
+        struct freeNode *node = p->free;
+        p->free = node->next;
+        return node;
+    }
+
+    if (p->curr == NULL || p->used == p->nodesPerSlab) {
+        // Move on to the next slab kept from before a reset, if any
+        struct slab *next = p->curr == NULL ? p->first : p->curr->next;
+        if (next == NULL) {
+            next = newSlab();
+            if (p->last == NULL) {
+                p->first = next;
+            } else {
+                p->last->next = next;
+            }
+            p->last = next;
+        }
+        p->curr = next;
+        p->used = 0;
+    }
+    return (char *)p->curr + SLAB_HEADER + p->used++ * p->nodeSize;
+}
+
+void NodePoolRelease(NodePool p, void *node) {
+    struct freeNode *f = node;
+    f->next = p->free;
+    p->free = f;
+    p->live--;
+}
+
+void NodePoolReset(NodePool p) {
+    p->curr = NULL;
+    p->used = 0;
+    p->free = NULL;
+    p->live = 0;
+}
+
+size_t NodePoolLive(NodePool p) {
+    return p->live;
+}
@@ -0,0 +1,33 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <stddef.h>
+
+// A pool of fixed-size nodes for the linked-list modules. Nodes are bump
+// allocated out of large slabs, released nodes go on a free list and are
+// handed out again before any fresh slab space, and every node in the pool
+// can be released at once without walking the lists that use them.
+typedef struct nodePool *NodePool;
+
+// Creates a new empty pool of nodes of the given size in bytes
+// nodeSize is rounded up so that every node is suitably aligned for any type
+NodePool NodePoolNew(size_t nodeSize);
+
+// Frees the pool and every node allocated from it
+void NodePoolFree(NodePool p);
+
+// Returns an uninitialised node, in O(1)
+void *NodePoolAlloc(NodePool p);
+
+// Returns a node to the pool for reuse, in O(1)
+// Assumes that node was allocated from p and has not been released since
+void NodePoolRelease(NodePool p, void *node);
+
+// Releases every node allocated from the pool, in O(1)
+// The pool keeps its slabs and reuses them for later allocations
+void NodePoolReset(NodePool p);
+
+// Returns the number of nodes allocated and not yet released
+size_t NodePoolLive(NodePool p);
+
+#endif // NODE_POOL_H
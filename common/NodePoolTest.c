@@ -0,0 +1,165 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdalign.h>
+#include <stddef.h>
+
+#include "NodePool.h"
+
+// ANSI colour codes
+#define RESET   "\033[0m"
+#define GREEN   "\033[32m"
+#define RED     "\033[31m"
+
+// Enough nodes to span many slabs
+#define MANY_NODES 100000
+
+struct node {
+    int value;
+    struct node *next;
+};
+
+// -----------------------------------------------------------------------------
+// Helper function to print test results in colour
+// -----------------------------------------------------------------------------
+static void run_test(const char *test_name, bool condition) {
+    if (condition) {
+        printf("%sTest %s: PASSED%s\n", GREEN, test_name, RESET);
+    } else {
+        printf("%sTest %s: FAILED%s\n", RED, test_name, RESET);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Helper function to print test suite headers
+// -----------------------------------------------------------------------------
+static void print_test_suite_header(const char *suite_name) {
+    printf("\nTest Suite: %s\n", suite_name);
+    printf("-----------------------\n");
+}
+
+static bool isAligned(void *node) {
+    return (uintptr_t)node % alignof(max_align_t) == 0;
+}
+
+// -----------------------------------------------------------------------------
+// Test Cases
+// -----------------------------------------------------------------------------
+
+// Test 1: Nodes are distinct, aligned and hold their values
+static void test_allocDistinct(void) {
+    print_test_suite_header("Alloc Distinct Nodes");
+    NodePool p = NodePoolNew(sizeof(struct node));
+    struct node **nodes = malloc(MANY_NODES * sizeof(struct node *));
+    if (nodes == NULL) {
+        printf("Memory allocation failed\n");
+        exit(1);
+    }
+
+    bool aligned = true;
+    for (int i = 0; i < MANY_NODES; i++) {
+        nodes[i] = NodePoolAlloc(p);
+        nodes[i]->value = i;
+        nodes[i]->next = i > 0 ? nodes[i - 1] : NULL;
+        aligned = aligned && isAligned(nodes[i]);
+    }
+    bool intact = true;
+    for (int i = 0; i < MANY_NODES; i++) {
+        intact = intact && nodes[i]->value == i &&
+                 nodes[i]->next == (i > 0 ? nodes[i - 1] : NULL);
+    }
+    run_test("nodes across many slabs are aligned", aligned);
+    run_test("nodes do not overlap", intact);
+    run_test("live count after allocating",
+             NodePoolLive(p) == MANY_NODES);
+
+    free(nodes);
+    NodePoolFree(p);
+}
+
+// Test 2: Released nodes are reused, most recently released first
+static void test_releaseReuse(void) {
+    print_test_suite_header("Release and Reuse");
+    NodePool p = NodePoolNew(sizeof(struct node));
+    struct node *a = NodePoolAlloc(p);
+    struct node *b = NodePoolAlloc(p);
+    struct node *c = NodePoolAlloc(p);
+    NodePoolRelease(p, b);
+    NodePoolRelease(p, a);
+    run_test("live count after releasing", NodePoolLive(p) == 1);
+    run_test("last released node is reused first", NodePoolAlloc(p) == a);
+    run_test("then the one released before it", NodePoolAlloc(p) == b);
+    struct node *d = NodePoolAlloc(p);
+    run_test("then fresh slab space",
+             d != a && d != b && d != c && isAligned(d));
+    NodePoolFree(p);
+}
+
+// Test 3: Reset releases everything and reuses the same slabs
+static void test_reset(void) {
+    print_test_suite_header("Reset");
+    NodePool p = NodePoolNew(sizeof(struct node));
+    void *first = NodePoolAlloc(p);
+    void *last = first;
+    for (int i = 1; i < MANY_NODES; i++) {
+        last = NodePoolAlloc(p);
+    }
+    NodePoolRelease(p, last);
+    NodePoolReset(p);
+    run_test("live count after reset", NodePoolLive(p) == 0);
+    run_test("allocation restarts at the first slab",
+             NodePoolAlloc(p) == first);
+
+    // Bumping through the kept slabs again must not hand out a node twice
+    struct node *prev = NULL;
+    for (int i = 1; i < MANY_NODES; i++) {
+        struct node *n = NodePoolAlloc(p);
+        n->value = i;
+        n->next = prev;
+        prev = n;
+    }
+    bool intact = true;
+    for (int i = MANY_NODES - 1; i >= 1; i--) {
+        intact = intact && prev != NULL && prev->value == i;
+        prev = prev->next;
+    }
+    run_test("refilled slabs hold distinct nodes", intact && prev == NULL);
+    NodePoolFree(p);
+}
+
+// Test 4: Odd node sizes are rounded up so every node stays aligned
+static void test_oddSizes(void) {
+    print_test_suite_header("Odd Node Sizes");
+    size_t sizes[] = {1, 3, 12, 17, 100, 1000};
+    int numSizes = sizeof(sizes) / sizeof(sizes[0]);
+    bool ok = true;
+    for (int i = 0; i < numSizes; i++) {
+        NodePool p = NodePoolNew(sizes[i]);
+        unsigned char *prev = NULL;
+        for (int j = 0; j < 1000; j++) {
+            unsigned char *node = NodePoolAlloc(p);
+            ok = ok && isAligned(node);
+            for (size_t k = 0; k < sizes[i]; k++) {
+                node[k] = (unsigned char)j;
+            }
+            // The previous node must not have been overwritten
+            ok = ok && (prev == NULL ||
+                        prev[sizes[i] - 1] == (unsigned char)(j - 1));
+            prev = node;
+        }
+        NodePoolFree(p);
+    }
+    run_test("nodes of odd sizes are aligned and disjoint", ok);
+}
+
+// -----------------------------------------------------------------------------
+// Run all tests
+// -----------------------------------------------------------------------------
+int main(void) {
+    test_allocDistinct();
+    test_releaseReuse();
+    test_reset();
+    test_oddSizes();
+    return 0;
+}
@@ -0,0 +1,210 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "UnrolledList.h"
+
+#define BLOCK_BYTES 128
+
+// A block's values occupy values[start .. start + count - 1]. Blocks made
+// by prepending fill from the back, so further prepends are O(1), and
+// blocks made by appending fill from the front.
+struct block {
+    struct block *next;
+    int start;
+    int count;
+    int values[(BLOCK_BYTES - sizeof(struct block *) - 2 * sizeof(int))
+               / sizeof(int)];
+};
+
+#define BLOCK_VALUES ((int)(sizeof(((struct block *)0)->values) / sizeof(int)))
+
+_Static_assert(sizeof(struct block) == BLOCK_BYTES,
+               "a block should fill its allocation exactly");
+
+struct unrolledList {
+    struct block *head;
+    struct block *tail;
+    int length;
+};
+
+static struct block *newBlock(int start) {
+    struct block *b = aligned_alloc(BLOCK_BYTES, sizeof(struct block));
+    if (b == NULL) {
+        printf("Memory allocation failed\n");
+        exit(1);
+    }
+    b->next = NULL;
+    b->start = start;
+    b->count = 0;
+    return b;
+}
+
+UnrolledList UnrolledListNew(void) {
+    UnrolledList l = malloc(sizeof(struct unrolledList));
+    if (l == NULL) {
+        printf("Memory allocation failed\n");
+        exit(1);
+    }
+    l->head = NULL;
+    l->tail = NULL;
+    l->length = 0;
+    return l;
+}
+
+void UnrolledListFree(UnrolledList l) {
+    struct block *b = l->head;
+    while (b != NULL) {
+        struct block *del = b;
+        b = b->next;
+        free(del);
+    }
+    free(l);
+}
+
+void UnrolledListPrepend(UnrolledList l, int value) {
+    struct block *b = l->head;
+    if (b == NULL || b->start == 0) {
+        b = newBlock(BLOCK_VALUES);
+        b->next = l->head;
+        l->head = b;
+        if (l->tail == NULL) l->tail = b;
+    }
+    b->values[--b->start] = value;
+    b->count++;
+    l->length++;
+}
+
+void UnrolledListAppend(UnrolledList l, int value) {
+    struct block *b = l->tail;
+    if (b == NULL || b->start + b->count == BLOCK_VALUES) {
+        b = newBlock(0);
+        if (l->tail == NULL) {
+            l->head = b;
+        } else {
+            l->tail->next = b;
+        }
+        l->tail = b;
+    }
+    b->values[b->start + b->count++] = value;
+    l->length++;
+}
+
+int UnrolledListLength(UnrolledList l) {
+    return l->length;
+}
+
+void UnrolledListToArray(UnrolledList l, int values[]) {
+    for (struct block *b = l->head; b != NULL; b = b->next) {
+        memcpy(values, &b->values[b->start], b->count * sizeof(int));
+        values += b->count;
+    }
+}
+
+// The loops below have no early exits or branches on the values, so each
+// block's values are summed, counted or compared a vector at a time
+
+int UnrolledListSum(UnrolledList l) {
+    // Unsigned, so that the wrap-around sumNodesWhile would hit on
+    // overflow is well defined here
+    unsigned sum = 0;
+    for (struct block *b = l->head; b != NULL; b = b->next) {
+        const int *v = &b->values[b->start];
+        for (int i = 0; i < b->count; i++) {
+            sum += (unsigned)v[i];
+        }
+    }
+    return (int)sum;
+}
+
+int UnrolledListCountOdds(UnrolledList l) {
+    int count = 0;
+    for (struct block *b = l->head; b != NULL; b = b->next) {
+        const int *v = &b->values[b->start];
+        for (int i = 0; i < b->count; i++) {
+            count += v[i] & 1;
+        }
+    }
+    return count;
+}
+
+bool UnrolledListIsSorted(UnrolledList l) {
+    struct block *prev = NULL;
+    for (struct block *b = l->head; b != NULL; prev = b, b = b->next) {
+        const int *v = &b->values[b->start];
+        if (prev != NULL && prev->values[prev->start + prev->count - 1] > v[0])
+            return false;
+        int descents = 0;
+        for (int i = 1; i < b->count; i++) {
+            descents |= v[i - 1] > v[i];
+        }
+        if (descents) return false;
+    }
+    return true;
+}
+
+// Returns the position of value within b's values, or -1
+static int findInBlock(struct block *b, int value) {
+    const int *v = &b->values[b->start];
+    // Check the whole block at once before looking for the position
+    int found = 0;
+    for (int i = 0; i < b->count; i++) {
+        found |= v[i] == value;
+    }
+    if (!found) return -1;
+    int i = 0;
+    while (v[i] != value) i++;
+    return i;
+}
+
+// Moves b's values to the front of its array
+static void compact(struct block *b) {
+    memmove(b->values, &b->values[b->start], b->count * sizeof(int));
+    b->start = 0;
+}
+
+bool UnrolledListDeleteFirstInstance(UnrolledList l, int value) {
+    struct block *prev = NULL;
+    struct block *b = l->head;
+    int pos = -1;
+    for (; b != NULL; prev = b, b = b->next) {
+        pos = findInBlock(b, value);
+        if (pos >= 0) break;
+    }
+    if (b == NULL) return false;
+
+    // Close the gap by shifting whichever side of it is shorter
+    int *v = &b->values[b->start];
+    if (pos < b->count / 2) {
+        memmove(v + 1, v, pos * sizeof(int));
+        b->start++;
+    } else {
+        memmove(v + pos, v + pos + 1, (b->count - pos - 1) * sizeof(int));
+    }
+    b->count--;
+    l->length--;
+
+    if (b->count == 0) {
+        // Unlink the now empty block
+        if (prev == NULL) {
+            l->head = b->next;
+        } else {
+            prev->next = b->next;
+        }
+        if (l->tail == b) l->tail = prev;
+        free(b);
+    } else if (b->next != NULL && b->count + b->next->count <= BLOCK_VALUES / 2) {
+        // Merge with the next block when both fit in half a block, so that
+        // deletions do not leave a trail of nearly empty blocks
+        struct block *next = b->next;
+        compact(b);
+        memcpy(&b->values[b->count], &next->values[next->start],
+               next->count * sizeof(int));
+        b->count += next->count;
+        b->next = next->next;
+        if (l->tail == next) l->tail = b;
+        free(next);
+    }
+    return true;
+}
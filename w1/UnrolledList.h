@@ -0,0 +1,45 @@
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+#include <stdbool.h>
+
+// A linked list of ints that stores up to 28 values per node ("block"),
+// each block one 128-byte allocation aligned to a 128-byte boundary. The
+// operations below walk each block's values with a plain loop over an
+// array, which the compiler can vectorise, and touch one block per 28
+// values instead of one node per value.
+typedef struct unrolledList *UnrolledList;
+
+// Creates a new empty list
+UnrolledList UnrolledListNew(void);
+
+// Frees the list
+void UnrolledListFree(UnrolledList l);
+
+// Adds a value to the front of the list, in O(1)
+void UnrolledListPrepend(UnrolledList l, int value);
+
+// Adds a value to the end of the list, in O(1)
+void UnrolledListAppend(UnrolledList l, int value);
+
+// Returns the number of values in the list, in O(1)
+int UnrolledListLength(UnrolledList l);
+
+// Copies the values in the list, front to back, into values
+// Assumes that values has room for UnrolledListLength(l) ints
+void UnrolledListToArray(UnrolledList l, int values[]);
+
+// Returns the sum of the values in the list
+int UnrolledListSum(UnrolledList l);
+
+// Counts the odd values in the list
+int UnrolledListCountOdds(UnrolledList l);
+
+// Returns whether the values in the list are in ascending order
+bool UnrolledListIsSorted(UnrolledList l);
+
+// Deletes the first instance of value from the list
+// Returns false if the value was not in the list
+bool UnrolledListDeleteFirstInstance(UnrolledList l, int value);
+
+#endif // UNROLLED_LIST_H
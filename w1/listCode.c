@@ -3,6 +3,8 @@
 #include <assert.h>
 #include <stdlib.h>
 
+#include "NodePool.h"
+
 // ANSI colour codes
 #define RESET   "\033[0m"
 #define GREEN   "\033[32m"
@@ -17,6 +19,9 @@ struct list {
     struct node *head;
 };
 
+// Every node comes from this pool, created on the first createNode
+static NodePool nodePool = NULL;
+
 // Function Declarations
 int sumNodesWhile(struct node *list);
 int sumNodesFor(struct node *list);
@@ -421,16 +426,14 @@ static void run_tests(void) {
 
 int main(void) {
     run_tests();
+    if (nodePool != NULL) NodePoolFree(nodePool);
     return 0;
 }
 
 // Function to create a node in memory
 struct node *createNode(int value) {
-    struct node *new = malloc(sizeof(struct node));
-    if (new == NULL) {
-        printf("Memory allocation failed\n");
-        exit(1);
-    }
+    if (nodePool == NULL) nodePool = NodePoolNew(sizeof(struct node));
+    struct node *new = NodePoolAlloc(nodePool);
     new->value = value;
     new->next = NULL;
     return new;
@@ -448,7 +451,7 @@ void freeList(struct node *list) {
     while (list != NULL) {
         struct node *del = list; 
         list = list->next;
-        free(del);
+        NodePoolRelease(nodePool, del);
     }
 }
 
@@ -492,7 +495,7 @@ struct node *deleteFirstInstance(struct node *list, int value) {
     // If value is at the head
     if (list->value == value) {
         struct node *newHead = list->next;
-        free(list);
+        NodePoolRelease(nodePool, list);
         return newHead;
     }
 
@@ -503,7 +506,7 @@ struct node *deleteFirstInstance(struct node *list, int value) {
     while (curr != NULL) {
         if (curr->value == value) {
             prev->next = curr->next;
-            free(curr);
+            NodePoolRelease(nodePool, curr);
             return list;
         }
         prev = prev->next;
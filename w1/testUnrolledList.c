@@ -0,0 +1,187 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "UnrolledList.h"
+
+// ANSI colour codes
+#define RESET   "\033[0m"
+#define GREEN   "\033[32m"
+#define RED     "\033[31m"
+
+// -----------------------------------------------------------------------------
+// Helper function to print test results in colour
+// -----------------------------------------------------------------------------
+static void run_test(const char *test_name, bool condition) {
+    if (condition) {
+        printf("%sTest %s: PASSED%s\n", GREEN, test_name, RESET);
+    } else {
+        printf("%sTest %s: FAILED%s\n", RED, test_name, RESET);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Helper function to print test suite headers
+// -----------------------------------------------------------------------------
+static void print_test_suite_header(const char *suite_name) {
+    printf("\nTest Suite: %s\n", suite_name);
+    printf("-----------------------\n");
+}
+
+// -----------------------------------------------------------------------------
+// Helper to check list contents against expected values
+// -----------------------------------------------------------------------------
+static bool checkListStructure(UnrolledList l, int expected[], int size) {
+    if (UnrolledListLength(l) != size) return false;
+    if (size == 0) return true;
+    int *values = malloc((size + 1) * sizeof(int));
+    if (values == NULL) {
+        printf("Memory allocation failed\n");
+        exit(1);
+    }
+    UnrolledListToArray(l, values);
+    bool same = memcmp(values, expected, size * sizeof(int)) == 0;
+    free(values);
+    return same;
+}
+
+// -----------------------------------------------------------------------------
+// Test Cases
+// -----------------------------------------------------------------------------
+
+// Test 1: Empty list
+static void test_emptyList(void) {
+    print_test_suite_header("Empty List");
+    UnrolledList l = UnrolledListNew();
+    run_test("sum of empty list", UnrolledListSum(l) == 0);
+    run_test("count odds of empty list", UnrolledListCountOdds(l) == 0);
+    run_test("empty list is sorted", UnrolledListIsSorted(l));
+    run_test("delete from empty list", !UnrolledListDeleteFirstInstance(l, 5)
+             && checkListStructure(l, NULL, 0));
+    UnrolledListFree(l);
+}
+
+// Test 2: Small list built by prepending
+static void test_smallList(void) {
+    print_test_suite_header("Small List");
+    UnrolledList l = UnrolledListNew();
+    UnrolledListPrepend(l, 3);
+    UnrolledListPrepend(l, -2);
+    UnrolledListPrepend(l, 3);
+    UnrolledListPrepend(l, -1); // -1 -> 3 -> -2 -> 3
+    int expected[] = {-1, 3, -2, 3};
+    run_test("structure after prepends", checkListStructure(l, expected, 4));
+    run_test("sum with negatives", UnrolledListSum(l) == 3);
+    run_test("count odds with negatives", UnrolledListCountOdds(l) == 3);
+    run_test("unsorted list", !UnrolledListIsSorted(l));
+
+    UnrolledListDeleteFirstInstance(l, 3);
+    int afterDelete[] = {-1, -2, 3};
+    run_test("delete first occurrence", checkListStructure(l, afterDelete, 3));
+    UnrolledListDeleteFirstInstance(l, -1);
+    UnrolledListDeleteFirstInstance(l, 3);
+    int afterMore[] = {-2};
+    run_test("delete head and last", checkListStructure(l, afterMore, 1)
+             && UnrolledListIsSorted(l));
+    run_test("delete non-existent value",
+             !UnrolledListDeleteFirstInstance(l, 7)
+             && checkListStructure(l, afterMore, 1));
+    UnrolledListDeleteFirstInstance(l, -2);
+    UnrolledListAppend(l, 4);
+    int afterAppend[] = {4};
+    run_test("append after emptying", checkListStructure(l, afterAppend, 1));
+    UnrolledListFree(l);
+}
+
+// Test 3: Sortedness across block boundaries
+static void test_sortedAcrossBlocks(void) {
+    print_test_suite_header("Sorted Across Blocks");
+    UnrolledList l = UnrolledListNew();
+    for (int i = 0; i < 1000; i++) UnrolledListAppend(l, i / 3);
+    run_test("long ascending list is sorted", UnrolledListIsSorted(l));
+    // The first block was filled from the front, so this goes into a new
+    // block ahead of it
+    UnrolledListPrepend(l, 1);
+    run_test("descent at the first boundary", !UnrolledListIsSorted(l));
+    UnrolledListFree(l);
+
+    l = UnrolledListNew();
+    for (int i = 1000; i > 0; i--) UnrolledListPrepend(l, i);
+    UnrolledListAppend(l, 0);
+    run_test("descent at the last value", !UnrolledListIsSorted(l));
+    UnrolledListDeleteFirstInstance(l, 0);
+    run_test("sorted again after deleting it", UnrolledListIsSorted(l));
+    UnrolledListFree(l);
+}
+
+// Test 4: Random operations against a plain array
+static void test_randomOperations(void) {
+    print_test_suite_header("Random Operations");
+    int capacity = 20000;
+    int *model = malloc(capacity * sizeof(int));
+    if (model == NULL) {
+        printf("Memory allocation failed\n");
+        exit(1);
+    }
+    int size = 0;
+    UnrolledList l = UnrolledListNew();
+    srand(2521);
+    bool ok = true;
+    for (int step = 0; step < 40000 && ok; step++) {
+        int op = rand() % 4;
+        int value = rand() % 100 - 50;
+        if (op == 0 && size < capacity) {
+            memmove(model + 1, model, size * sizeof(int));
+            model[0] = value;
+            size++;
+            UnrolledListPrepend(l, value);
+        } else if (op == 1 && size < capacity) {
+            model[size++] = value;
+            UnrolledListAppend(l, value);
+        } else {
+            int i = 0;
+            while (i < size && model[i] != value) i++;
+            bool found = i < size;
+            if (found) {
+                memmove(model + i, model + i + 1, (size - i - 1) * sizeof(int));
+                size--;
+            }
+            if (UnrolledListDeleteFirstInstance(l, value) != found) ok = false;
+        }
+        if (step % 1000 == 0 && !checkListStructure(l, model, size)) ok = false;
+    }
+    run_test("matches array after prepends, appends and deletes",
+             ok && checkListStructure(l, model, size));
+
+    int sum = 0, odds = 0;
+    for (int i = 0; i < size; i++) {
+        sum += model[i];
+        odds += (model[i] % 2 != 0);
+    }
+    run_test("sum matches", UnrolledListSum(l) == sum);
+    run_test("count odds matches", UnrolledListCountOdds(l) == odds);
+
+    // Delete everything, front to back
+    for (int i = 0; i < size; i++) {
+        UnrolledListDeleteFirstInstance(l, model[i]);
+    }
+    run_test("empty after deleting every value", checkListStructure(l, NULL, 0));
+    UnrolledListFree(l);
+    free(model);
+}
+
+// -----------------------------------------------------------------------------
+// Run all tests
+// -----------------------------------------------------------------------------
+static void run_tests(void) {
+    test_emptyList();
+    test_smallList();
+    test_sortedAcrossBlocks();
+    test_randomOperations();
+}
+
+int main(void) {
+    run_tests();
+    return 0;
+}
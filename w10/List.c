@@ -1,24 +1,95 @@
+#define _GNU_SOURCE     // mremap
 #include "List.h"
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #define INITIAL_CAPACITY 8
+#define FILE_MAGIC 0x5453494c31323532ULL   // "2521LIST"
+
+/** Layout at the start of a file-backed list; the items follow it */
+struct fileHeader {
+    uint64_t magic;
+    int64_t size;
+};
 
 struct list {
     Item *data;      // 0-based C array
     int size;        // number of elements
     int capacity;    // allocated capacity
+    int fd;          // backing file, or -1 for a heap list
+    struct fileHeader *header;  // start of the mapping (file lists only)
 };
 
-/** Double the capacity when we run out of space */
-static void resize(List list) {
-    list->capacity *= 2;
-    list->data = realloc(list->data,
-                         list->capacity * sizeof *list->data);
-    if (!list->data) {
-        perror("realloc");
+static size_t mappedBytes(int capacity) {
+    return sizeof(struct fileHeader) + (size_t)capacity * sizeof(Item);
+}
+
+/** Resize the backing file and its mapping to hold capacity items */
+static void remapFile(List list, int capacity) {
+    size_t oldBytes = mappedBytes(list->capacity);
+    size_t newBytes = mappedBytes(capacity);
+    if (newBytes > oldBytes && ftruncate(list->fd, newBytes) == -1) {
+        perror("ftruncate");
+        exit(EXIT_FAILURE);
+    }
+    void *map = mremap(list->header, oldBytes, newBytes, MREMAP_MAYMOVE);
+    if (map == MAP_FAILED) {
+        perror("mremap");
         exit(EXIT_FAILURE);
     }
+    if (newBytes < oldBytes && ftruncate(list->fd, newBytes) == -1) {
+        perror("ftruncate");
+        exit(EXIT_FAILURE);
+    }
+    list->header = map;
+    list->data = (Item *)(list->header + 1);
+}
+
+/** Reallocate the backing array to hold exactly capacity items */
+static void setCapacity(List list, int capacity) {
+    if (list->fd != -1) {
+        remapFile(list, capacity);
+    } else {
+        Item *data = realloc(list->data, capacity * sizeof *list->data);
+        if (!data) {
+            perror("realloc");
+            exit(EXIT_FAILURE);
+        }
+        list->data = data;
+    }
+    list->capacity = capacity;
+}
+
+/** Grow to at least needed items, at least doubling so appends stay O(1) */
+static void grow(List list, int needed) {
+    int capacity = (list->capacity > INT_MAX / 2) ? INT_MAX
+                                                  : list->capacity * 2;
+    if (capacity < needed) capacity = needed;
+    setCapacity(list, capacity);
+}
+
+/** Report an out of bounds index; kept out of line so checks stay cheap */
+__attribute__((noinline, cold, noreturn))
+static void indexError(const List list, int index) {
+    fprintf(stderr, "error: index %d out of bounds (size = %d)\n",
+            index, list->size);
+    exit(EXIT_FAILURE);
+}
+
+/** Report a list that would need more items than an int index can reach */
+__attribute__((noinline, cold, noreturn))
+static void sizeError(long long items) {
+    fprintf(stderr, "error: %lld items is more than the %d a list can "
+            "index\n", items, INT_MAX);
+    exit(EXIT_FAILURE);
 }
 
 List ListNew(void) {
@@ -29,6 +100,8 @@ List ListNew(void) {
     }
     list->size     = 0;
     list->capacity = INITIAL_CAPACITY;
+    list->fd       = -1;
+    list->header   = NULL;
     list->data     = malloc(list->capacity * sizeof *list->data);
     if (!list->data) {
         perror("malloc");
@@ -37,36 +110,139 @@ List ListNew(void) {
     return list;
 }
 
+List ListOpen(const char *path) {
+    List list = malloc(sizeof *list);
+    if (!list) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    list->fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (list->fd == -1) {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+    struct stat st;
+    if (fstat(list->fd, &st) == -1) {
+        perror("fstat");
+        exit(EXIT_FAILURE);
+    }
+
+    bool fresh = (st.st_size == 0);
+    if (fresh) {
+        list->capacity = INITIAL_CAPACITY;
+        if (ftruncate(list->fd, mappedBytes(list->capacity)) == -1) {
+            perror("ftruncate");
+            exit(EXIT_FAILURE);
+        }
+    } else if ((size_t)st.st_size < sizeof(struct fileHeader)) {
+        fprintf(stderr, "error: %s is not a list file\n", path);
+        exit(EXIT_FAILURE);
+    } else {
+        // Indices are ints, so refuse files holding more items than that
+        // rather than letting the capacity wrap
+        off_t items = (st.st_size - (off_t)sizeof(struct fileHeader))
+                      / (off_t)sizeof(Item);
+        if (items > INT_MAX) {
+            fprintf(stderr, "error: %s holds %lld items, more than the "
+                    "%d a list can index\n", path, (long long)items, INT_MAX);
+            exit(EXIT_FAILURE);
+        }
+        list->capacity = (int)items;
+    }
+
+    void *map = mmap(NULL, mappedBytes(list->capacity),
+                     PROT_READ | PROT_WRITE, MAP_SHARED, list->fd, 0);
+    if (map == MAP_FAILED) {
+        perror("mmap");
+        exit(EXIT_FAILURE);
+    }
+    list->header = map;
+    list->data = (Item *)(list->header + 1);
+
+    if (fresh) {
+        list->header->magic = FILE_MAGIC;
+        list->header->size = 0;
+    } else if (list->header->magic != FILE_MAGIC
+               || list->header->size < 0
+               || list->header->size > list->capacity) {
+        fprintf(stderr, "error: %s is not a list file\n", path);
+        exit(EXIT_FAILURE);
+    }
+    list->size = list->header->size;
+    return list;
+}
+
+void ListSync(List list) {
+    if (list->fd == -1) return;
+    list->header->size = list->size;
+    if (msync(list->header, mappedBytes(list->capacity), MS_SYNC) == -1) {
+        perror("msync");
+        exit(EXIT_FAILURE);
+    }
+}
+
 void ListFree(List list) {
-    free(list->data);
+    if (list->fd != -1) {
+        list->header->size = list->size;
+        munmap(list->header, mappedBytes(list->capacity));
+        close(list->fd);
+    } else {
+        free(list->data);
+    }
     free(list);
 }
 
 void ListAppend(List list, Item it) {
     if (list->size == list->capacity) {
-        resize(list);
+        if (list->size == INT_MAX) sizeError((long long)list->size + 1);
+        grow(list, list->size + 1);
     }
     list->data[list->size++] = it;
 }
 
+void ListAppendArray(List list, const Item items[], int n) {
+    if (n <= 0) return;
+    if (n > INT_MAX - list->size) sizeError((long long)list->size + n);
+    ListReserve(list, list->size + n);
+    memcpy(list->data + list->size, items, n * sizeof *items);
+    list->size += n;
+}
+
+void ListReserve(List list, int capacity) {
+    if (capacity > list->capacity) {
+        grow(list, capacity);
+    }
+}
+
+void ListShrinkToFit(List list) {
+    int capacity = (list->size > 0) ? list->size : 1;
+    if (capacity < list->capacity) {
+        setCapacity(list, capacity);
+    }
+}
+
 Item ListGet(const List list, int index) {
-    if (index < 0 || index >= list->size) {
-        fprintf(stderr, "error: index %d out of bounds (size = %d)\n",
-                index, list->size);
-        exit(EXIT_FAILURE);
+    if ((unsigned)index >= (unsigned)list->size) {
+        indexError(list, index);
     }
     return list->data[index];
 }
 
 void ListSet(List list, int index, Item it) {
-    if (index < 0 || index >= list->size) {
-        fprintf(stderr, "error: index %d out of bounds (size = %d)\n",
-                index, list->size);
-        exit(EXIT_FAILURE);
+    if ((unsigned)index >= (unsigned)list->size) {
+        indexError(list, index);
     }
     list->data[index] = it;
 }
 
+Item *ListData(List list) {
+    return list->data;
+}
+
 int ListSize(const List list) {
     return list->size;
 }
+
+int ListCapacity(const List list) {
+    return list->capacity;
+}
@@ -8,19 +8,55 @@ typedef struct list *List;
 /** Create a new empty List */
 List ListNew(void);
 
-/** Free all memory used by the list */
+/**
+ * Open the list stored in the file at path, creating an empty one if the
+ * file does not exist. The items are memory-mapped rather than read, so
+ * opening is instant and the list can be larger than RAM. Appends grow
+ * the file. Indices are ints, so one list holds at most INT_MAX items;
+ * opening a file with more than that exits with an error.
+ */
+List ListOpen(const char *path);
+
+/** Flush a file-backed list to disk (no effect for in-memory lists) */
+void ListSync(List list);
+
+/**
+ * Free all memory used by the list. A file-backed list records its size
+ * and is unmapped; the file itself is kept.
+ */
 void ListFree(List list);
 
 /** Append an item to the end */
 void ListAppend(List list, Item it);
 
+/**
+ * Append items[0..n-1] to the end with a single copy. Exits with an error
+ * if the list would then hold more than INT_MAX items.
+ */
+void ListAppendArray(List list, const Item items[], int n);
+
+/** Make room for at least capacity items without further reallocation */
+void ListReserve(List list, int capacity);
+
+/** Release any capacity beyond the current size */
+void ListShrinkToFit(List list);
+
 /** Get the item at index (0 ≤ index < size) */
 Item ListGet(const List list, int index);
 
 /** Set the item at index (0 ≤ index < size) */
 void ListSet(List list, int index, Item it);
 
+/**
+ * Return the underlying array for unchecked access in tight loops.
+ * Valid for indices 0..size-1 until the next call that may grow the list.
+ */
+Item *ListData(List list);
+
 /** Return the number of items currently in the list */
 int ListSize(const List list);
 
+/** Return the number of items the list can hold before it must grow */
+int ListCapacity(const List list);
+
 #endif /* LIST_H */
@@ -80,6 +80,17 @@ int MinHeapDeleteMin(MinHeap h) {
     return ret;
 }
 
+int MinHeapReplaceMin(MinHeap h, int val) {
+    if (h->size == 0) {
+        fprintf(stderr, "error: heap is empty\n");
+        exit(EXIT_FAILURE);
+    }
+    int ret = h->data[1];
+    h->data[1] = val;
+    sift_down(h, 1);
+    return ret;
+}
+
 int MinHeapSize(MinHeap h) {
     return h->size;
 }
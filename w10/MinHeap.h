@@ -19,6 +19,12 @@ int MinHeapPeek(MinHeap h);
 /** Remove and return the smallest value */
 int MinHeapDeleteMin(MinHeap h);
 
+/**
+ * Replace the smallest value with val and return the old smallest value.
+ * Cheaper than a DeleteMin followed by an Insert.
+ */
+int MinHeapReplaceMin(MinHeap h, int val);
+
 /** Return the size of the min heap */
 int MinHeapSize(MinHeap h);
 
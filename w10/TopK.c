@@ -0,0 +1,162 @@
+#include "TopK.h"
+#include "MinHeap.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+
+// On x86 the AVX2 filter is compiled for that target alone and picked at
+// run time, so the default build still runs on CPUs without AVX2
+#if defined(__x86_64__) || defined(__i386__)
+#define TOPK_AVX2_DISPATCH
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define FILTER_BLOCK 16
+
+struct topk {
+    MinHeap heap;   // the k largest values seen so far
+    int k;          // maximum number of values to keep
+    bool full;      // heap holds k values
+    int threshold;  // heap minimum, valid once full
+};
+
+TopK TopKNew(int k) {
+    TopK t = malloc(sizeof *t);
+    if (!t) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    t->heap = MinHeapNew();
+    t->k = k;
+    t->full = (k == 0);
+    t->threshold = 0;
+    return t;
+}
+
+void TopKFree(TopK t) {
+    MinHeapFree(t->heap);
+    free(t);
+}
+
+/** Slow path: the heap is still filling, or val beats the minimum */
+static void admit(TopK t, int val) {
+    if (!t->full) {
+        MinHeapInsert(t->heap, val);
+        if (MinHeapSize(t->heap) < t->k) return;
+        t->full = true;
+    } else {
+        MinHeapReplaceMin(t->heap, val);
+    }
+    t->threshold = MinHeapPeek(t->heap);
+}
+
+void TopKAdd(TopK t, int val) {
+    if (t->full && (t->k == 0 || val <= t->threshold)) return;
+    admit(t, val);
+}
+
+/**
+ * Return a bitmask with bit i set when block[i] > threshold, for the
+ * FILTER_BLOCK values starting at block. Compares 4 lanes per instruction
+ * with SSE2, one at a time otherwise.
+ */
+static unsigned aboveMask(const int *block, int threshold) {
+#if defined(__SSE2__)
+    __m128i t = _mm_set1_epi32(threshold);
+    unsigned mask = 0;
+    for (int i = 0; i < FILTER_BLOCK; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(block + i));
+        unsigned m = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(v, t)));
+        mask |= m << i;
+    }
+    return mask;
+#else
+    unsigned mask = 0;
+    for (int i = 0; i < FILTER_BLOCK; i++) {
+        mask |= (unsigned)(block[i] > threshold) << i;
+    }
+    return mask;
+#endif
+}
+
+/**
+ * Offer the values of block whose bits are set in mask, lowest index
+ * first. Admitting one can raise the threshold, so TopKAdd checks each
+ * of them again.
+ */
+static inline void addMasked(TopK t, const int *block, unsigned mask) {
+    while (mask) {
+        TopKAdd(t, block[__builtin_ctz(mask)]);
+        mask &= mask - 1;
+    }
+}
+
+/** Filter whole blocks of arr from index i on; return the first index left */
+static int filterBlocks(TopK t, const int arr[], int i, int n) {
+    for (; i + FILTER_BLOCK <= n; i += FILTER_BLOCK) {
+        addMasked(t, arr + i, aboveMask(arr + i, t->threshold));
+    }
+    return i;
+}
+
+#ifdef TOPK_AVX2_DISPATCH
+/** As filterBlocks, comparing 8 lanes per instruction with AVX2 */
+__attribute__((target("avx2")))
+static int filterBlocksAvx2(TopK t, const int arr[], int i, int n) {
+    for (; i + FILTER_BLOCK <= n; i += FILTER_BLOCK) {
+        __m256i th = _mm256_set1_epi32(t->threshold);
+        __m256i lo = _mm256_loadu_si256((const __m256i *)(arr + i));
+        __m256i hi = _mm256_loadu_si256((const __m256i *)(arr + i + 8));
+        unsigned mlo = _mm256_movemask_ps(
+            _mm256_castsi256_ps(_mm256_cmpgt_epi32(lo, th)));
+        unsigned mhi = _mm256_movemask_ps(
+            _mm256_castsi256_ps(_mm256_cmpgt_epi32(hi, th)));
+        addMasked(t, arr + i, mlo | (mhi << 8));
+    }
+    return i;
+}
+#endif
+
+void TopKAddArray(TopK t, int arr[], int n) {
+    int i = 0;
+    while (i < n && !t->full) {
+        TopKAdd(t, arr[i++]);
+    }
+    if (t->k == 0) return;
+
+    // Steady state: filter a block against the threshold and only hand the
+    // survivors to the heap
+#ifdef TOPK_AVX2_DISPATCH
+    if (__builtin_cpu_supports("avx2")) {
+        i = filterBlocksAvx2(t, arr, i, n);
+    }
+#endif
+    i = filterBlocks(t, arr, i, n);
+
+    for (; i < n; i++) {
+        TopKAdd(t, arr[i]);
+    }
+}
+
+void TopKMerge(TopK dst, TopK src) {
+    while (!MinHeapEmpty(src->heap)) {
+        TopKAdd(dst, MinHeapDeleteMin(src->heap));
+    }
+    src->full = (src->k == 0);
+}
+
+int TopKSize(TopK t) {
+    return MinHeapSize(t->heap);
+}
+
+List TopKResult(TopK t) {
+    List res = ListNew();
+    ListReserve(res, MinHeapSize(t->heap));
+    while (!MinHeapEmpty(t->heap)) {
+        ListAppend(res, MinHeapDeleteMin(t->heap));
+    }
+    t->full = (t->k == 0);
+    return res;
+}
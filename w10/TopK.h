@@ -0,0 +1,35 @@
+#ifndef TOPK_H
+#define TOPK_H
+
+#include "List.h"
+
+typedef struct topk *TopK;
+
+/** Create an accumulator that keeps the k largest values it is given */
+TopK TopKNew(int k);
+
+/** Free all memory used by the accumulator */
+void TopKFree(TopK t);
+
+/**
+ * Offer a value to the accumulator. Once k values are held, anything
+ * at or below the current minimum is rejected without touching the heap.
+ */
+void TopKAdd(TopK t, int val);
+
+/** Offer arr[0..n-1] to the accumulator */
+void TopKAddArray(TopK t, int arr[], int n);
+
+/** Move every value held by src into dst, leaving src empty */
+void TopKMerge(TopK dst, TopK src);
+
+/** Return the number of values currently held (at most k) */
+int TopKSize(TopK t);
+
+/**
+ * Remove the held values and return them as a List in ascending order.
+ * The accumulator is left empty and can be reused.
+ */
+List TopKResult(TopK t);
+
+#endif /* TOPK_H */
@@ -3,30 +3,223 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <pthread.h>
 #include "List.h"
-#include "MinHeap.h"
+#include "TopK.h"
+
+#define INSERTION_THRESHOLD 16
+#define SELECT_THRESHOLD    64
+// Largest input kLargestValues will copy for selection (256 MiB of ints);
+// above this it streams through the heap so mapped inputs need not fit in RAM
+#define SELECT_MAX_COPY     (1 << 26)
+
+static void swap(int *a, int *b) {
+    int tmp = *a; *a = *b; *b = tmp;
+}
+
+static void insertionSort(int a[], int lo, int hi) {
+    for (int i = lo + 1; i <= hi; i++) {
+        int val = a[i];
+        int j = i - 1;
+        while (j >= lo && a[j] > val) {
+            a[j + 1] = a[j];
+            j--;
+        }
+        a[j + 1] = val;
+    }
+}
+
+static int cmpInt(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+static int selectValue(int a[], int lo, int hi, int k, int budget);
 
 /**
- * Return a List of the k largest values in arr[0..n-1], in ascending order.
+ * Median-of-medians pivot for a[lo..hi]: sort groups of 5, move each
+ * group's median to the front, then select the median of those.
+ * Guarantees a 30/70 split, so selection stays linear in the worst case.
+ */
+static int medianOfMedians(int a[], int lo, int hi) {
+    int n = hi - lo + 1;
+    if (n <= 5) {
+        insertionSort(a, lo, hi);
+        return a[lo + n / 2];
+    }
+    int m = 0;
+    for (int i = lo; i <= hi; i += 5) {
+        int end = (i + 4 < hi) ? i + 4 : hi;
+        insertionSort(a, i, end);
+        swap(&a[lo + m], &a[i + (end - i) / 2]);
+        m++;
+    }
+    return selectValue(a, lo, lo + m - 1, lo + m / 2, 0);
+}
+
+static int medianOfThree(int a, int b, int c) {
+    if (a < b) {
+        if (b < c) return b;
+        return (a < c) ? c : a;
+    }
+    if (a < c) return a;
+    return (b < c) ? c : b;
+}
+
+/**
+ * Introselect: rearrange a[lo..hi] so that a[k] holds the value it would
+ * have if the range were sorted, everything before it is <= and everything
+ * after it is >=. Uses median-of-three quickselect while `budget` lasts and
+ * falls back to median-of-medians once it runs out (budget 0 means always
+ * use median-of-medians). Returns a[k].
+ */
+static int selectValue(int a[], int lo, int hi, int k, int budget) {
+    while (hi - lo + 1 > INSERTION_THRESHOLD) {
+        int pivot;
+        if (budget > 0) {
+            budget--;
+            pivot = medianOfThree(a[lo], a[lo + (hi - lo) / 2], a[hi]);
+        } else {
+            pivot = medianOfMedians(a, lo, hi);
+        }
+
+        // Three-way partition: [lo, lt) < pivot, [lt, gt] == pivot,
+        // (gt, hi] > pivot. Keeps runs of duplicates from going quadratic.
+        int lt = lo, i = lo, gt = hi;
+        while (i <= gt) {
+            if (a[i] < pivot) {
+                swap(&a[lt++], &a[i++]);
+            } else if (a[i] > pivot) {
+                swap(&a[i], &a[gt--]);
+            } else {
+                i++;
+            }
+        }
+
+        if (k < lt) {
+            hi = lt - 1;
+        } else if (k > gt) {
+            lo = gt + 1;
+        } else {
+            return a[k];
+        }
+    }
+    insertionSort(a, lo, hi);
+    return a[k];
+}
+
+/**
+ * Heap-based kLargestValues: O(n log k) worst case, close to O(n) once the
+ * heap is warm since most values fall below its minimum and are rejected.
  * Precondition: 0 <= k <= n.
  */
-List kLargestValues(int arr[], int n, int k) {
-    MinHeap h = MinHeapNew();
-    for (int i = 0; i < n; i++) {
-        MinHeapInsert(h, arr[i]);
-        if (MinHeapSize(h) > k) {
-            MinHeapDeleteMin(h);
+List kLargestValuesHeap(int arr[], int n, int k) {
+    TopK t = TopKNew(k);
+    TopKAddArray(t, arr, n);
+    List res = TopKResult(t);
+    TopKFree(t);
+    return res;
+}
+
+struct worker {
+    int *arr;       // this worker's slice of the input
+    int n;          // length of the slice
+    TopK acc;       // this worker's private accumulator
+};
+
+static void *runWorker(void *arg) {
+    struct worker *w = arg;
+    TopKAddArray(w->acc, w->arr, w->n);
+    return NULL;
+}
+
+/**
+ * Parallel kLargestValues: splits arr across nthreads threads, each with
+ * its own accumulator, then merges the per-thread results.
+ * Precondition: 0 <= k <= n. nthreads < 1 is treated as 1.
+ */
+List kLargestValuesParallel(int arr[], int n, int k, int nthreads) {
+    if (nthreads < 1) nthreads = 1;
+    if (nthreads > n) nthreads = (n > 0) ? n : 1;
+
+    struct worker *workers = malloc(nthreads * sizeof *workers);
+    pthread_t *threads = malloc(nthreads * sizeof *threads);
+    if (!workers || !threads) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+
+    int chunk = n / nthreads, extra = n % nthreads, start = 0;
+    for (int i = 0; i < nthreads; i++) {
+        workers[i].arr = arr + start;
+        workers[i].n = chunk + (i < extra);
+        workers[i].acc = TopKNew(k);
+        start += workers[i].n;
+        if (i > 0 && pthread_create(&threads[i], NULL, runWorker,
+                                    &workers[i]) != 0) {
+            fprintf(stderr, "error: pthread_create failed\n");
+            exit(EXIT_FAILURE);
         }
     }
+    runWorker(&workers[0]);
 
+    for (int i = 1; i < nthreads; i++) {
+        pthread_join(threads[i], NULL);
+        TopKMerge(workers[0].acc, workers[i].acc);
+        TopKFree(workers[i].acc);
+    }
+    List res = TopKResult(workers[0].acc);
+    TopKFree(workers[0].acc);
+    free(threads);
+    free(workers);
+    return res;
+}
+
+/**
+ * Selection-based kLargestValues: partitions a copy of arr in expected
+ * O(n) (worst case O(n) via median-of-medians), then sorts only the top k.
+ * The copy takes n ints of memory, so arr (e.g. a file-backed list's data)
+ * must fit in RAM; use kLargestValuesHeap for anything larger.
+ * Precondition: 0 <= k <= n.
+ */
+List kLargestValuesSelect(int arr[], int n, int k) {
     List res = ListNew();
-    while (!MinHeapEmpty(h)) {
-        ListAppend(res, MinHeapDeleteMin(h));
+    if (k == 0) return res;
+
+    int *tmp = malloc(n * sizeof *tmp);
+    if (!tmp) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < n; i++) {
+        tmp[i] = arr[i];
     }
-    MinHeapFree(h);
+
+    if (k < n) {
+        int budget = 0;
+        for (int m = n; m > 1; m /= 2) budget += 2;
+        selectValue(tmp, 0, n - 1, n - k, budget);
+    }
+    qsort(tmp + (n - k), k, sizeof *tmp, cmpInt);
+
+    ListAppendArray(res, tmp + (n - k), k);
+    free(tmp);
     return res;
 }
 
+/**
+ * Return a List of the k largest values in arr[0..n-1], in ascending order.
+ * Uses the heap when k is small relative to n or arr is too large to copy
+ * (so a memory-mapped arr is only ever streamed), and selection otherwise.
+ * Precondition: 0 <= k <= n.
+ */
+List kLargestValues(int arr[], int n, int k) {
+    if (k <= n / SELECT_THRESHOLD || n > SELECT_MAX_COPY) {
+        return kLargestValuesHeap(arr, n, k);
+    }
+    return kLargestValuesSelect(arr, n, k);
+}
+
 /* -----------------------------------------------------------------------------
    ANSI Colour Codes for Test Output
    -----------------------------------------------------------------------------
@@ -108,11 +301,154 @@ static void test_duplicates(void) {
     ListFree(res);
 }
 
+// Compares both engines against a fully sorted copy of arr
+static bool enginesAgree(int arr[], int n, int k) {
+    int *sorted = malloc(n * sizeof *sorted);
+    if (!sorted) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < n; i++) sorted[i] = arr[i];
+    qsort(sorted, n, sizeof *sorted, cmpInt);
+
+    List heap = kLargestValuesHeap(arr, n, k);
+    List sel = kLargestValuesSelect(arr, n, k);
+    List par = kLargestValuesParallel(arr, n, k, 4);
+    List serial = kLargestValuesParallel(arr, n, k, 0);
+    bool ok = listEquals(heap, sorted + (n - k), k)
+           && listEquals(sel, sorted + (n - k), k)
+           && listEquals(par, sorted + (n - k), k)
+           && listEquals(serial, sorted + (n - k), k);
+    ListFree(heap);
+    ListFree(sel);
+    ListFree(par);
+    ListFree(serial);
+    free(sorted);
+    return ok;
+}
+
+static void test_select_matches_heap(void) {
+    print_header("Selection vs Heap vs Parallel");
+    int n = 5000;
+    int *arr = malloc(n * sizeof *arr);
+    if (!arr) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+
+    srand(2521);
+    for (int i = 0; i < n; i++) arr[i] = rand() % 100000 - 50000;
+    run_test("random, k = n/2", enginesAgree(arr, n, n / 2));
+    run_test("random, k = 10", enginesAgree(arr, n, 10));
+    run_test("random, k = 1, odd n", enginesAgree(arr, n - 3, 1));
+    run_test("random, k = 0", enginesAgree(arr, n, 0));
+    run_test("random, k = n", enginesAgree(arr, n, n));
+
+    for (int i = 0; i < n; i++) arr[i] = i;
+    run_test("ascending, k = n/3", enginesAgree(arr, n, n / 3));
+
+    for (int i = 0; i < n; i++) arr[i] = n - i;
+    run_test("descending, k = n/3", enginesAgree(arr, n, n / 3));
+
+    for (int i = 0; i < n; i++) arr[i] = rand() % 4;
+    run_test("few distinct values, k = n/2", enginesAgree(arr, n, n / 2));
+
+    free(arr);
+}
+
+static void test_topk_streaming(void) {
+    print_header("Streaming TopK");
+    TopK a = TopKNew(3);
+    TopK b = TopKNew(3);
+    int first[] = {7, 1, 9, 3};
+    int second[] = {8, 2, 10, 4};
+    TopKAddArray(a, first, 4);
+    TopKAddArray(b, second, 4);
+    run_test("bounded at k", TopKSize(a) == 3 && TopKSize(b) == 3);
+
+    TopKMerge(a, b);
+    run_test("merge empties source", TopKSize(b) == 0);
+    List res = TopKResult(a);
+    int exp[] = {8, 9, 10};
+    run_test("merged 8,9,10", listEquals(res, exp, 3));
+    ListFree(res);
+
+    TopKAdd(a, 5);
+    res = TopKResult(a);
+    int exp2[] = {5};
+    run_test("reusable after result", listEquals(res, exp2, 1));
+    ListFree(res);
+
+    TopKFree(a);
+    TopKFree(b);
+}
+
+static void test_list_bulk(void) {
+    print_header("List bulk operations");
+    List lst = ListNew();
+    ListReserve(lst, 100);
+    run_test("reserve grows capacity", ListCapacity(lst) >= 100);
+
+    int vals[] = {1, 2, 3, 4, 5};
+    ListAppendArray(lst, vals, 5);
+    ListAppendArray(lst, vals, 2);
+    int exp[] = {1, 2, 3, 4, 5, 1, 2};
+    run_test("append array", listEquals(lst, exp, 7));
+
+    ListShrinkToFit(lst);
+    run_test("shrink to fit", ListCapacity(lst) == 7 && listEquals(lst, exp, 7));
+
+    ListData(lst)[0] = 9;
+    run_test("raw data view", ListGet(lst, 0) == 9);
+
+    ListAppend(lst, 6);
+    run_test("append after shrink", ListSize(lst) == 8 && ListGet(lst, 7) == 6);
+    ListFree(lst);
+}
+
+static void test_list_file(void) {
+    print_header("File-backed List");
+    const char *path = "kLargestValues.test.list";
+    remove(path);
+
+    List lst = ListOpen(path);
+    for (int i = 0; i < 1000; i++) {
+        ListAppend(lst, (i * 37) % 1000);
+    }
+    ListSet(lst, 0, 5000);
+    ListFree(lst);
+
+    lst = ListOpen(path);
+    bool ok = ListSize(lst) == 1000 && ListGet(lst, 0) == 5000;
+    for (int i = 1; i < 1000 && ok; i++) {
+        ok = ListGet(lst, i) == (i * 37) % 1000;
+    }
+    run_test("persists across reopen", ok);
+
+    List res = kLargestValues(ListData(lst), ListSize(lst), 3);
+    int exp[] = {998, 999, 5000};
+    run_test("kLargestValues over mapped data", listEquals(res, exp, 3));
+    ListFree(res);
+
+    ListShrinkToFit(lst);
+    ListAppendArray(lst, exp, 3);
+    ListFree(lst);
+    lst = ListOpen(path);
+    run_test("shrink then append", ListSize(lst) == 1003
+                                   && ListGet(lst, 1002) == 5000);
+    ListFree(lst);
+    remove(path);
+}
+
 int main(void) {
     test_simple();
     test_k_equals_n();
     test_k_one();
     test_negative();
     test_duplicates();
+    test_select_matches_heap();
+    test_topk_streaming();
+    test_list_bulk();
+    test_list_file();
     return 0;
 }
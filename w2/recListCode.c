@@ -1,13 +1,26 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
 #include <assert.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+
+#include "NodePool.h"
 
 // ANSI colour codes
 #define RESET   "\033[0m"
 #define GREEN   "\033[32m"
 #define RED     "\033[31m"
 
+// Deep enough that the recursive versions would overflow a default 8 MiB stack
+#define DEEP_LIST_LENGTH (1 << 22)
+
+// Largest list the benchmark tries unless told otherwise on the command line
+#define BENCH_DEFAULT_MAX (1 << 23)
+
 // -----------------------------------------------------------------------------
 // Data Types
 // -----------------------------------------------------------------------------
@@ -20,6 +33,9 @@ struct list {
     struct node *head;
 };
 
+// Every node comes from this pool, created on the first createNode
+static NodePool nodePool = NULL;
+
 // -----------------------------------------------------------------------------
 // Recursive Function Declarations (node pointer interface)
 // -----------------------------------------------------------------------------
@@ -36,11 +52,25 @@ int listCountOddsWrapper(struct list *l);
 bool listIsSortedWrapper(struct list *l);
 void listDeleteWrapper(struct list *l, int value);
 
+// -----------------------------------------------------------------------------
+// Iterative Function Declarations (same semantics, constant stack space)
+// -----------------------------------------------------------------------------
+int listLengthIter(struct node *l);
+int listCountOddsIter(struct node *l);
+bool listIsSortedIter(struct node *l);
+struct node *listDeleteIter(struct node *l, int value);
+
+int listLengthIterWrapper(struct list *l);
+int listCountOddsIterWrapper(struct list *l);
+bool listIsSortedIterWrapper(struct list *l);
+void listDeleteIterWrapper(struct list *l, int value);
+
 // -----------------------------------------------------------------------------
 // Helper Function Declarations
 // -----------------------------------------------------------------------------
 struct node *createNode(int value);
 struct node *prependNode(int value, struct node *list);
+struct node *buildAscending(int n);
 void freeList(struct node *list);
 void printList(struct node *list);
 static bool checkListStructure(struct node *list, int expected[], int size);
@@ -68,6 +98,7 @@ static void test_listIsSorted_single(void);
 static void test_listIsSorted_sorted(void);
 static void test_listIsSorted_unsorted(void);
 static void test_listIsSorted_duplicates(void);
+static void test_listIsSorted_unsortedTail(void);
 
 // --- Test Cases for listDelete ---
 static void test_listDelete_empty(void);
@@ -84,14 +115,35 @@ static void test_wrapper_listCountOdds(void);
 static void test_wrapper_listIsSorted(void);
 static void test_wrapper_listDelete(void);
 
+// --- Test Cases for Iterative Functions ---
+static void test_iter_matchesRecursive(void);
+static void test_iter_listDelete(void);
+static void test_iter_wrappers(void);
+static void test_iter_deepList(void);
+
+// --- Benchmark ---
+static void run_bench(int maxLength);
+
 // --- Helper to Run All Tests ---
 static void run_tests(void);
 
 // -----------------------------------------------------------------------------
 // Main Function
 // -----------------------------------------------------------------------------
-int main(void) {
-    run_tests();
+int main(int argc, char *argv[]) {
+    // ./recListCode bench [maxLength] compares the recursive and iterative
+    // versions on doubling list lengths instead of running the tests
+    if (argc > 1 && strcmp(argv[1], "bench") == 0) {
+        int maxLength = argc > 2 ? atoi(argv[2]) : BENCH_DEFAULT_MAX;
+        if (maxLength <= 0) {
+            fprintf(stderr, "usage: %s bench [maxLength]\n", argv[0]);
+            return 1;
+        }
+        run_bench(maxLength);
+    } else {
+        run_tests();
+    }
+    if (nodePool != NULL) NodePoolFree(nodePool);
     return 0;
 }
 
@@ -247,6 +299,18 @@ static void test_listIsSorted_duplicates(void) {
     freeList(list);
 }
 
+static void test_listIsSorted_unsortedTail(void) {
+    print_test_suite_header("listIsSorted - Unsorted Past the First Pair");
+    struct node *list = NULL;
+    list = prependNode(3, list);
+    list = prependNode(4, list);
+    list = prependNode(2, list);
+    list = prependNode(1, list); // List: 1 -> 2 -> 4 -> 3
+    bool sorted = listIsSorted(list);
+    run_test("List 1->2->4->3 should not be sorted", sorted == false);
+    freeList(list);
+}
+
 // -----------------------------------------------------------------------------
 // Test Cases for listDelete()
 // -----------------------------------------------------------------------------
@@ -392,6 +456,101 @@ static void test_wrapper_listDelete(void) {
     freeList(l.head);
 }
 
+// -----------------------------------------------------------------------------
+// Test Cases for Iterative Functions
+// -----------------------------------------------------------------------------
+static void test_iter_matchesRecursive(void) {
+    print_test_suite_header("Iterative - Agree With Recursive Versions");
+    int lists[][5] = {
+        {1, 2, 3, 4, 5}, {1, 1, 2, 2, 3}, {5, 4, 3, 2, 1},
+        {1, 2, 4, 3, 5}, {-3, -1, 0, 7, 7}, {2, 4, 6, 8, 9},
+    };
+    int numLists = sizeof(lists) / sizeof(lists[0]);
+    bool ok = listLengthIter(NULL) == 0 && listCountOddsIter(NULL) == 0 &&
+              listIsSortedIter(NULL);
+    for (int i = 0; i < numLists; i++) {
+        // Check every prefix so single-node lists are covered too
+        for (int len = 1; len <= 5; len++) {
+            struct node *list = NULL;
+            for (int j = len - 1; j >= 0; j--) {
+                list = prependNode(lists[i][j], list);
+            }
+            ok = ok && listLengthIter(list) == listLength(list);
+            ok = ok && listCountOddsIter(list) == listCountOdds(list);
+            ok = ok && listIsSortedIter(list) == listIsSorted(list);
+            freeList(list);
+        }
+    }
+    run_test("Iterative length, odd count and sortedness match", ok);
+}
+
+static void test_iter_listDelete(void) {
+    print_test_suite_header("Iterative - listDelete");
+    struct node *list = NULL;
+    list = prependNode(1, list);
+    list = prependNode(3, list);
+    list = prependNode(2, list);
+    list = prependNode(3, list); // List: 3 -> 2 -> 3 -> 1
+
+    struct node *original = list;
+    list = listDeleteIter(list, 4);
+    int expected1[] = {3, 2, 3, 1};
+    run_test("Deleting non-existent value leaves list unchanged",
+             list == original && checkListStructure(list, expected1, 4));
+
+    struct node *second = list->next;
+    list = listDeleteIter(list, 3);
+    int expected2[] = {2, 3, 1};
+    run_test("Deleting head removes first occurrence only",
+             list == second && checkListStructure(list, expected2, 3));
+
+    list = listDeleteIter(list, 1);
+    int expected3[] = {2, 3};
+    run_test("Deleting last node updates list structure",
+             list == second && checkListStructure(list, expected3, 2));
+
+    list = listDeleteIter(list, 2);
+    list = listDeleteIter(list, 3);
+    run_test("Deleting every node yields empty list", list == NULL);
+    run_test("Deleting from empty list yields empty list",
+             listDeleteIter(NULL, 5) == NULL);
+}
+
+static void test_iter_wrappers(void) {
+    print_test_suite_header("Iterative - Wrappers");
+    struct list l;
+    l.head = NULL;
+    // Build list: 3 -> 2 -> 1
+    l.head = prependNode(1, l.head);
+    l.head = prependNode(2, l.head);
+    l.head = prependNode(3, l.head);
+    run_test("Wrapper listLengthIter should return 3",
+             listLengthIterWrapper(&l) == 3);
+    run_test("Wrapper listCountOddsIter should return 2",
+             listCountOddsIterWrapper(&l) == 2);
+    run_test("Wrapper listIsSortedIter should return false for 3->2->1",
+             listIsSortedIterWrapper(&l) == false);
+    listDeleteIterWrapper(&l, 3);
+    int expected[] = {2, 1};
+    run_test("Wrapper listDeleteIter should delete the head",
+             checkListStructure(l.head, expected, 2));
+    freeList(l.head);
+}
+
+static void test_iter_deepList(void) {
+    print_test_suite_header("Iterative - Deep List");
+    int n = DEEP_LIST_LENGTH;
+    struct node *list = buildAscending(n);
+    run_test("Length of a 2^22 node list", listLengthIter(list) == n);
+    run_test("Odd count of a 2^22 node list", listCountOddsIter(list) == n / 2);
+    run_test("2^22 node ascending list is sorted", listIsSortedIter(list));
+    list = listDeleteIter(list, n - 1);
+    list = listDeleteIter(list, -1);
+    run_test("Deleting the last node of a 2^22 node list",
+             listLengthIter(list) == n - 1 && listIsSortedIter(list));
+    freeList(list);
+}
+
 // -----------------------------------------------------------------------------
 // Run All Tests
 // -----------------------------------------------------------------------------
@@ -413,6 +572,7 @@ static void run_tests(void) {
     test_listIsSorted_sorted();
     test_listIsSorted_unsorted();
     test_listIsSorted_duplicates();
+    test_listIsSorted_unsortedTail();
 
     // listDelete tests
     test_listDelete_empty();
@@ -428,6 +588,12 @@ static void run_tests(void) {
     test_wrapper_listCountOdds();
     test_wrapper_listIsSorted();
     test_wrapper_listDelete();
+
+    // Iterative tests
+    test_iter_matchesRecursive();
+    test_iter_listDelete();
+    test_iter_wrappers();
+    test_iter_deepList();
 }
 
 // -----------------------------------------------------------------------------
@@ -452,7 +618,7 @@ bool listIsSorted(struct node *l) {
     if (l == NULL || l->next == NULL)
         return true;
     if (l->value > l->next->value) return false;
-    return true;
+    return listIsSorted(l->next);
 }
 
 // Recursively delete the first instance of a value from the list
@@ -460,7 +626,7 @@ struct node *listDelete(struct node *l, int value) {
     if (l == NULL) return NULL;
     if (l->value == value) {
         struct node *nextNode = l->next;
-        free(l);
+        NodePoolRelease(nodePool, l);
         return nextNode;
     }
     l->next = listDelete(l->next, value);
@@ -487,14 +653,198 @@ void listDeleteWrapper(struct list *l, int value) {
 }
 
 // -----------------------------------------------------------------------------
-// Helper Functions to Manage Linked Lists
+// Implementation of Iterative Functions
 // -----------------------------------------------------------------------------
-struct node *createNode(int value) {
-    struct node *newNode = malloc(sizeof(struct node));
-    if (newNode == NULL) {
-        printf("Memory allocation failed\n");
+
+// Iteratively compute the length of a linked list
+int listLengthIter(struct node *l) {
+    int length = 0;
+    for (struct node *curr = l; curr != NULL; curr = curr->next) {
+        length++;
+    }
+    return length;
+}
+
+// Iteratively count the number of odd numbers in a linked list
+int listCountOddsIter(struct node *l) {
+    int count = 0;
+    for (struct node *curr = l; curr != NULL; curr = curr->next) {
+        if (curr->value % 2 == 1) count++;
+    }
+    return count;
+}
+
+// Iteratively check if a list is sorted in ascending order
+bool listIsSortedIter(struct node *l) {
+    if (l == NULL) return true;
+    for (struct node *curr = l; curr->next != NULL; curr = curr->next) {
+        if (curr->value > curr->next->value) return false;
+    }
+    return true;
+}
+
+// Deletes the first node holding value from the list that *link points to.
+// Walks a pointer to the link that points at the current node, so the only
+// write is to the single link that skips the deleted node.
+static void deleteFromLink(struct node **link, int value) {
+    while (*link != NULL && (*link)->value != value) {
+        link = &(*link)->next;
+    }
+    if (*link != NULL) {
+        struct node *victim = *link;
+        *link = victim->next;
+        NodePoolRelease(nodePool, victim);
+    }
+}
+
+// Iteratively delete the first instance of a value from the list
+struct node *listDeleteIter(struct node *l, int value) {
+    deleteFromLink(&l, value);
+    return l;
+}
+
+int listLengthIterWrapper(struct list *l) {
+    return listLengthIter(l->head);
+}
+
+int listCountOddsIterWrapper(struct list *l) {
+    return listCountOddsIter(l->head);
+}
+
+bool listIsSortedIterWrapper(struct list *l) {
+    return listIsSortedIter(l->head);
+}
+
+void listDeleteIterWrapper(struct list *l, int value) {
+    deleteFromLink(&l->head, value);
+}
+
+// -----------------------------------------------------------------------------
+// Benchmark: recursive vs iterative on doubling list lengths
+// -----------------------------------------------------------------------------
+
+// Volatile so the compiler cannot drop calls whose result is unused
+static volatile long benchSink;
+
+static double elapsedMs(struct timespec start, struct timespec end) {
+    return (end.tv_sec - start.tv_sec) * 1e3 +
+           (end.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+// Runs one of the list functions on the list; which selects the function and
+// recursive selects the version. listDelete looks for a missing value so
+// both versions walk the entire list.
+static void benchCall(int which, bool recursive, struct node *list) {
+    switch (which) {
+    case 0: benchSink = recursive ? listLength(list) : listLengthIter(list);
+            break;
+    case 1: benchSink = recursive ? listCountOdds(list)
+                                  : listCountOddsIter(list);
+            break;
+    case 2: benchSink = recursive ? listIsSorted(list)
+                                  : listIsSortedIter(list);
+            break;
+    default:
+        benchSink = (long)(recursive ? listDelete(list, -1)
+                                     : listDeleteIter(list, -1));
+        break;
+    }
+}
+
+// Times the recursive version in a forked child so that a stack overflow
+// only kills the child. Returns the time in ms, or -1 with *sig set to the
+// signal that killed the child.
+static double benchRecursive(int which, struct node *list, int *sig) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        perror("pipe");
         exit(1);
     }
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        exit(1);
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        struct timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        benchCall(which, true, list);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        double ms = elapsedMs(start, end);
+        if (write(fds[1], &ms, sizeof(ms)) != sizeof(ms)) _exit(1);
+        _exit(0);
+    }
+    close(fds[1]);
+    double ms = -1;
+    if (read(fds[0], &ms, sizeof(ms)) != sizeof(ms)) ms = -1;
+    close(fds[0]);
+    int status;
+    waitpid(pid, &status, 0);
+    *sig = WIFSIGNALED(status) ? WTERMSIG(status) : 0;
+    return *sig == 0 ? ms : -1;
+}
+
+static void run_bench(int maxLength) {
+    const char *names[] = {"listLength", "listCountOdds", "listIsSorted",
+                           "listDelete"};
+    int crashedAt[4] = {0, 0, 0, 0};
+
+    struct rlimit rl;
+    if (getrlimit(RLIMIT_STACK, &rl) == 0 && rl.rlim_cur != RLIM_INFINITY) {
+        printf("Stack limit: %lu KiB\n", (unsigned long)rl.rlim_cur / 1024);
+    } else {
+        printf("Stack limit: unlimited\n");
+    }
+    printf("%10s  %-14s %14s %14s\n", "length", "function", "recursive ms",
+           "iterative ms");
+
+    for (int n = 1024; n <= maxLength; n *= 2) {
+        struct node *list = buildAscending(n);
+        for (int which = 0; which < 4; which++) {
+            int sig = 0;
+            double recMs = benchRecursive(which, list, &sig);
+
+            struct timespec start, end;
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            benchCall(which, false, list);
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            double iterMs = elapsedMs(start, end);
+
+            if (sig != 0) {
+                if (crashedAt[which] == 0) crashedAt[which] = n;
+                printf("%10d  %-14s %14s %14.3f\n", n, names[which],
+                       strsignal(sig), iterMs);
+            } else {
+                printf("%10d  %-14s %14.3f %14.3f\n", n, names[which],
+                       recMs, iterMs);
+            }
+        }
+        // The list is the only thing allocated from the pool, so release it
+        // in one step rather than node by node
+        NodePoolReset(nodePool);
+        if (n > maxLength / 2) break;
+    }
+
+    printf("\n");
+    for (int which = 0; which < 4; which++) {
+        if (crashedAt[which] != 0) {
+            printf("%-14s recursive version first failed at %d nodes\n",
+                   names[which], crashedAt[which]);
+        } else {
+            printf("%-14s recursive version survived every length\n",
+                   names[which]);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Helper Functions to Manage Linked Lists
+// -----------------------------------------------------------------------------
+struct node *createNode(int value) {
+    if (nodePool == NULL) nodePool = NodePoolNew(sizeof(struct node));
+    struct node *newNode = NodePoolAlloc(nodePool);
     newNode->value = value;
     newNode->next = NULL;
     return newNode;
@@ -506,11 +856,20 @@ struct node *prependNode(int value, struct node *list) {
     return newNode;
 }
 
+// Builds the list 0 -> 1 -> ... -> n - 1
+struct node *buildAscending(int n) {
+    struct node *list = NULL;
+    for (int i = n - 1; i >= 0; i--) {
+        list = prependNode(i, list);
+    }
+    return list;
+}
+
 void freeList(struct node *list) {
     while (list != NULL) {
         struct node *temp = list;
         list = list->next;
-        free(temp);
+        NodePoolRelease(nodePool, temp);
     }
 }
 
@@ -0,0 +1,351 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "ItemSort.h"
+
+static void *allocate(size_t bytes) {
+    void *p = malloc(bytes > 0 ? bytes : 1);
+    if (p == NULL) {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+// -----------------------------------------------------------------------------
+// Radix Sort
+// -----------------------------------------------------------------------------
+
+#define RADIX_BITS 8
+#define RADIX (1 << RADIX_BITS)
+#define RADIX_PASSES (32 / RADIX_BITS)
+
+// Flipping the sign bit makes unsigned order match signed order
+static inline uint32_t radixKey(int x) {
+    return (uint32_t)x ^ 0x80000000u;
+}
+
+static inline int digit(int key, int pass) {
+    return (radixKey(key) >> (pass * RADIX_BITS)) & (RADIX - 1);
+}
+
+// Counts every pass's digits in one read of the keys, then turns each
+// pass's counts into starting offsets. Returns a mask of the passes that
+// would move something (a pass where all keys share a digit would not)
+static unsigned countDigits(size_t offsets[RADIX_PASSES][RADIX],
+                            const int *keys, size_t stride, int n) {
+    memset(offsets, 0, RADIX_PASSES * RADIX * sizeof(size_t));
+    for (int i = 0; i < n; i++) {
+        int key = *(const int *)((const char *)keys + i * stride);
+        for (int p = 0; p < RADIX_PASSES; p++) {
+            offsets[p][digit(key, p)]++;
+        }
+    }
+    unsigned passes = 0;
+    for (int p = 0; p < RADIX_PASSES; p++) {
+        if (offsets[p][digit(keys[0], p)] != (size_t)n) passes |= 1u << p;
+        size_t next = 0;
+        for (int d = 0; d < RADIX; d++) {
+            size_t count = offsets[p][d];
+            offsets[p][d] = next;
+            next += count;
+        }
+    }
+    return passes;
+}
+
+void itemRadixSort(Item items[], int n) {
+    if (n < 2) return;
+    static _Thread_local size_t offsets[RADIX_PASSES][RADIX];
+    unsigned passes = countDigits(offsets, &items[0].a, sizeof(Item), n);
+    Item *buffer = allocate(n * sizeof(Item));
+    Item *from = items, *to = buffer;
+    for (int p = 0; p < RADIX_PASSES; p++) {
+        if (!(passes & (1u << p))) continue;
+        for (int i = 0; i < n; i++) {
+            to[offsets[p][digit(from[i].a, p)]++] = from[i];
+        }
+        Item *tmp = from;
+        from = to;
+        to = tmp;
+    }
+    if (from != items) memcpy(items, from, n * sizeof(Item));
+    free(buffer);
+}
+
+void itemRadixSortSoA(int keys[], int values[], int n) {
+    if (n < 2) return;
+    static _Thread_local size_t offsets[RADIX_PASSES][RADIX];
+    unsigned passes = countDigits(offsets, keys, sizeof(int), n);
+    int *keyBuffer = allocate(n * sizeof(int));
+    int *valueBuffer = allocate(n * sizeof(int));
+    int *keysFrom = keys, *keysTo = keyBuffer;
+    int *valuesFrom = values, *valuesTo = valueBuffer;
+    for (int p = 0; p < RADIX_PASSES; p++) {
+        if (!(passes & (1u << p))) continue;
+        for (int i = 0; i < n; i++) {
+            size_t j = offsets[p][digit(keysFrom[i], p)]++;
+            keysTo[j] = keysFrom[i];
+            valuesTo[j] = valuesFrom[i];
+        }
+        int *tmp = keysFrom;
+        keysFrom = keysTo;
+        keysTo = tmp;
+        tmp = valuesFrom;
+        valuesFrom = valuesTo;
+        valuesTo = tmp;
+    }
+    if (keysFrom != keys) {
+        memcpy(keys, keysFrom, n * sizeof(int));
+        memcpy(values, valuesFrom, n * sizeof(int));
+    }
+    free(keyBuffer);
+    free(valueBuffer);
+}
+
+// -----------------------------------------------------------------------------
+// TimSort
+// -----------------------------------------------------------------------------
+
+// A merge switches to galloping once one run has won this many times in
+// a row
+#define MIN_GALLOP 7
+
+// Enough for any int length: run lengths on the stack grow at least as
+// fast as the Fibonacci numbers
+#define MAX_RUNS 85
+
+struct run {
+    int base;
+    int len;
+};
+
+struct timSort {
+    Item *items;
+    Item *tmp;          // scratch for the shorter run of a merge
+    struct run runs[MAX_RUNS];
+    int numRuns;
+};
+
+// Returns how many items at the start of sorted arr[0..n-1] have keys
+// <= key (inclusive) or < key (not inclusive), searching exponentially
+// from the left and then by bisection
+static int gallop(int key, const Item *arr, int n, bool inclusive) {
+    int bound = 1;
+    while (bound <= n && (inclusive ? arr[bound - 1].a <= key
+                                    : arr[bound - 1].a < key)) {
+        bound *= 2;
+    }
+    int lo = bound / 2;
+    int hi = (bound <= n) ? bound - 1 : n;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (inclusive ? arr[mid].a <= key : arr[mid].a < key)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+static void reverse(Item *arr, int lo, int hi) {
+    for (hi--; lo < hi; lo++, hi--) {
+        Item tmp = arr[lo];
+        arr[lo] = arr[hi];
+        arr[hi] = tmp;
+    }
+}
+
+// Returns the length of the run starting at lo, reversing it in place if
+// it is strictly descending (strictly, so that reversing keeps stability)
+static int countRun(Item *arr, int lo, int hi) {
+    int r = lo + 1;
+    if (r == hi) return 1;
+    if (arr[r].a < arr[lo].a) {
+        while (r < hi && arr[r].a < arr[r - 1].a) r++;
+        reverse(arr, lo, r);
+    } else {
+        while (r < hi && arr[r].a >= arr[r - 1].a) r++;
+    }
+    return r - lo;
+}
+
+// Extends the sorted arr[lo..start-1] to arr[lo..hi-1] by binary insertion,
+// placing each item after any equal keys
+static void binaryInsertionSort(Item *arr, int lo, int hi, int start) {
+    for (int i = start; i < hi; i++) {
+        Item x = arr[i];
+        int pos = lo + gallop(x.a, arr + lo, i - lo, true);
+        memmove(arr + pos + 1, arr + pos, (i - pos) * sizeof(Item));
+        arr[pos] = x;
+    }
+}
+
+// Returns a run length between 32 and 64 such that n / minRun is, or is
+// a little less than, a power of two, so that the final merges balance
+static int minRunLength(int n) {
+    int extra = 0;
+    while (n >= 64) {
+        extra |= n & 1;
+        n >>= 1;
+    }
+    return n + extra;
+}
+
+// Merges run a (copied to tmp) with the run b that follows it, filling
+// from the left. Whatever remains of b at the end is already in place
+static void mergeLo(Item *dest, Item *a, int na, Item *b, int nb) {
+    int i = 0, j = 0, k = 0;
+    while (i < na && j < nb) {
+        int winsA = 0, winsB = 0;
+        while (i < na && j < nb && winsA < MIN_GALLOP && winsB < MIN_GALLOP) {
+            if (b[j].a < a[i].a) {
+                dest[k++] = b[j++];
+                winsB++;
+                winsA = 0;
+            } else {
+                dest[k++] = a[i++];
+                winsA++;
+                winsB = 0;
+            }
+        }
+        if (i == na || j == nb) break;
+        // One run keeps winning: move its next block in one go
+        if (winsA == MIN_GALLOP) {
+            int count = gallop(b[j].a, a + i, na - i, true);
+            memcpy(dest + k, a + i, count * sizeof(Item));
+            i += count;
+            k += count;
+        } else {
+            int count = gallop(a[i].a, b + j, nb - j, false);
+            memmove(dest + k, b + j, count * sizeof(Item));
+            j += count;
+            k += count;
+        }
+    }
+    memcpy(dest + k, a + i, (na - i) * sizeof(Item));
+}
+
+// Merges the run a with the run b that follows it (copied to tmp),
+// filling from the right. Whatever remains of a at the end is in place
+static void mergeHi(Item *a, int na, Item *b, int nb) {
+    int i = na - 1, j = nb - 1, k = na + nb - 1;
+    while (i >= 0 && j >= 0) {
+        int winsA = 0, winsB = 0;
+        while (i >= 0 && j >= 0 && winsA < MIN_GALLOP && winsB < MIN_GALLOP) {
+            if (b[j].a < a[i].a) {
+                a[k--] = a[i--];
+                winsA++;
+                winsB = 0;
+            } else {
+                a[k--] = b[j--];
+                winsB++;
+                winsA = 0;
+            }
+        }
+        if (i < 0 || j < 0) break;
+        if (winsA == MIN_GALLOP) {
+            int count = i + 1 - gallop(b[j].a, a, i + 1, true);
+            memmove(a + k - count + 1, a + i - count + 1,
+                    count * sizeof(Item));
+            i -= count;
+            k -= count;
+        } else {
+            int count = j + 1 - gallop(a[i].a, b, j + 1, false);
+            memcpy(a + k - count + 1, b + j - count + 1,
+                   count * sizeof(Item));
+            j -= count;
+            k -= count;
+        }
+    }
+    memcpy(a, b, (j + 1) * sizeof(Item));
+}
+
+// Merges runs n and n + 1 on the stack
+static void mergeAt(struct timSort *ts, int n) {
+    Item *a = ts->items + ts->runs[n].base;
+    int na = ts->runs[n].len;
+    Item *b = ts->items + ts->runs[n + 1].base;
+    int nb = ts->runs[n + 1].len;
+
+    ts->runs[n].len = na + nb;
+    if (n == ts->numRuns - 3) ts->runs[n + 1] = ts->runs[n + 2];
+    ts->numRuns--;
+
+    // Items of a no greater than b's first are already in place, as are
+    // items of b no less than a's last
+    int skip = gallop(b[0].a, a, na, true);
+    a += skip;
+    na -= skip;
+    if (na == 0) return;
+    nb = gallop(a[na - 1].a, b, nb, false);
+    if (nb == 0) return;
+
+    if (na <= nb) {
+        memcpy(ts->tmp, a, na * sizeof(Item));
+        mergeLo(a, ts->tmp, na, b, nb);
+    } else {
+        memcpy(ts->tmp, b, nb * sizeof(Item));
+        mergeHi(a, na, ts->tmp, nb);
+    }
+}
+
+// Merges runs until, from the top of the stack down, each run is longer
+// than the next two together, so that merges stay balanced
+static void mergeCollapse(struct timSort *ts) {
+    struct run *r = ts->runs;
+    while (ts->numRuns > 1) {
+        int n = ts->numRuns - 2;
+        if ((n > 0 && r[n - 1].len <= r[n].len + r[n + 1].len)
+            || (n > 1 && r[n - 2].len <= r[n - 1].len + r[n].len)) {
+            if (r[n - 1].len < r[n + 1].len) n--;
+        } else if (r[n].len > r[n + 1].len) {
+            break;
+        }
+        mergeAt(ts, n);
+    }
+}
+
+static void mergeForceCollapse(struct timSort *ts) {
+    while (ts->numRuns > 1) {
+        int n = ts->numRuns - 2;
+        if (n > 0 && ts->runs[n - 1].len < ts->runs[n + 1].len) n--;
+        mergeAt(ts, n);
+    }
+}
+
+void itemTimSort(Item items[], int n) {
+    if (n < 2) return;
+    struct timSort ts = { items, allocate((n / 2 + 1) * sizeof(Item)), {{0}}, 0 };
+    int minRun = minRunLength(n);
+    for (int lo = 0; lo < n; ) {
+        int len = countRun(items, lo, n);
+        if (len < minRun) {
+            int forced = (n - lo < minRun) ? n - lo : minRun;
+            binaryInsertionSort(items, lo, lo + forced, lo + len);
+            len = forced;
+        }
+        ts.runs[ts.numRuns++] = (struct run){ lo, len };
+        mergeCollapse(&ts);
+        lo += len;
+    }
+    mergeForceCollapse(&ts);
+    free(ts.tmp);
+}
+
+void itemTimSortSoA(int keys[], int values[], int n) {
+    if (n < 2) return;
+    Item *items = allocate(n * sizeof(Item));
+    for (int i = 0; i < n; i++) {
+        items[i] = (Item){ keys[i], values[i] };
+    }
+    itemTimSort(items, n);
+    for (int i = 0; i < n; i++) {
+        keys[i] = items[i].a;
+        values[i] = items[i].b;
+    }
+    free(items);
+}
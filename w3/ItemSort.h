@@ -0,0 +1,30 @@
+#ifndef ITEM_SORT_H
+#define ITEM_SORT_H
+
+// A record with a key (a) and a payload (b)
+typedef struct {
+    int a;
+    int b;
+} Item;
+
+// All of the sorts below order items by a and are stable: items with equal
+// keys stay in their original relative order. Scratch space is allocated
+// once per call, never per item.
+
+// Sorts items[0..n-1] with an LSD radix sort on a. O(n), n items of scratch
+void itemRadixSort(Item items[], int n);
+
+// Same as itemRadixSort, for items stored as two parallel arrays: item i
+// is {keys[i], values[i]}. n keys and n values of scratch
+void itemRadixSortSoA(int keys[], int values[], int n);
+
+// Sorts items[0..n-1] with TimSort: natural runs extended by binary
+// insertion sort, merged with galloping. O(n) on sorted or reversed input,
+// O(n log n) at worst, at most n / 2 items of scratch
+void itemTimSort(Item items[], int n);
+
+// Same as itemTimSort, for items stored as two parallel arrays. The items
+// are packed into one buffer of n items, sorted and unpacked
+void itemTimSortSoA(int keys[], int values[], int n);
+
+#endif // ITEM_SORT_H
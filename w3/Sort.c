@@ -0,0 +1,335 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include <pthread.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef __SSE4_1__
+#include <smmintrin.h>
+#endif
+
+#include "Sort.h"
+
+static void *allocate(size_t bytes) {
+    void *p = malloc(bytes > 0 ? bytes : 1);
+    if (p == NULL) {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+// -----------------------------------------------------------------------------
+// Radix Sort
+// -----------------------------------------------------------------------------
+
+#define RADIX_BITS 8
+#define RADIX (1 << RADIX_BITS)
+#define RADIX_PASSES (32 / RADIX_BITS)
+
+// Flipping the sign bit makes unsigned order match signed order
+static inline uint32_t radixKey(int x) {
+    return (uint32_t)x ^ 0x80000000u;
+}
+
+void radixSort(int a[], int n) {
+    if (n <= SMALL_SORT_MAX) {
+        smallSort(a, n);
+        return;
+    }
+    // One read of the input counts the digits for every pass
+    static _Thread_local size_t counts[RADIX_PASSES][RADIX];
+    memset(counts, 0, sizeof(counts));
+    for (int i = 0; i < n; i++) {
+        uint32_t key = radixKey(a[i]);
+        for (int p = 0; p < RADIX_PASSES; p++) {
+            counts[p][(key >> (p * RADIX_BITS)) & (RADIX - 1)]++;
+        }
+    }
+
+    int *buffer = allocate(n * sizeof(int));
+    int *from = a, *to = buffer;
+    for (int p = 0; p < RADIX_PASSES; p++) {
+        int shift = p * RADIX_BITS;
+        // A pass where every key has the same digit would not move anything
+        if (counts[p][(radixKey(a[0]) >> shift) & (RADIX - 1)] == (size_t)n)
+            continue;
+        size_t next = 0;
+        for (int d = 0; d < RADIX; d++) {
+            size_t count = counts[p][d];
+            counts[p][d] = next;
+            next += count;
+        }
+        for (int i = 0; i < n; i++) {
+            int digit = (radixKey(from[i]) >> shift) & (RADIX - 1);
+            to[counts[p][digit]++] = from[i];
+        }
+        int *tmp = from;
+        from = to;
+        to = tmp;
+    }
+    if (from != a) memcpy(a, from, n * sizeof(int));
+    free(buffer);
+}
+
+// -----------------------------------------------------------------------------
+// Sorting Network
+// -----------------------------------------------------------------------------
+
+#ifdef __SSE2__
+
+// The 16 values are held in four vectors of four. The columns are sorted
+// with a 4-input network, the 4x4 block is transposed so that each vector
+// holds a sorted row, and the rows are combined with bitonic merges.
+
+static inline __m128i min32(__m128i a, __m128i b) {
+#ifdef __SSE4_1__
+    return _mm_min_epi32(a, b);
+#else
+    __m128i gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+#endif
+}
+
+static inline __m128i max32(__m128i a, __m128i b) {
+#ifdef __SSE4_1__
+    return _mm_max_epi32(a, b);
+#else
+    __m128i gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+#endif
+}
+
+static inline void compareExchange(__m128i *a, __m128i *b) {
+    __m128i lo = min32(*a, *b);
+    *b = max32(*a, *b);
+    *a = lo;
+}
+
+static inline __m128i reverse(__m128i v) {
+    return _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3));
+}
+
+// Sorts a bitonic vector
+static inline __m128i bitonicClean(__m128i v) {
+    __m128i s = _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+    v = _mm_unpacklo_epi64(min32(v, s), max32(v, s));
+    s = _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+    __m128i lo = min32(v, s), hi = max32(v, s);
+    return _mm_unpacklo_epi64(_mm_unpacklo_epi32(lo, hi),
+                              _mm_unpackhi_epi32(lo, hi));
+}
+
+// Merges sorted vectors a and b into sorted (a, b)
+static inline void merge4(__m128i *a, __m128i *b) {
+    __m128i r = reverse(*b);
+    __m128i lo = min32(*a, r), hi = max32(*a, r);
+    *a = bitonicClean(lo);
+    *b = bitonicClean(hi);
+}
+
+// Merges sorted (a0, a1) and (b0, b1) into sorted (a0, a1, b0, b1)
+static inline void merge8(__m128i *a0, __m128i *a1, __m128i *b0,
+                          __m128i *b1) {
+    __m128i r0 = reverse(*b1), r1 = reverse(*b0);
+    __m128i lo0 = min32(*a0, r0), hi0 = max32(*a0, r0);
+    __m128i lo1 = min32(*a1, r1), hi1 = max32(*a1, r1);
+    compareExchange(&lo0, &lo1);
+    compareExchange(&hi0, &hi1);
+    *a0 = bitonicClean(lo0);
+    *a1 = bitonicClean(lo1);
+    *b0 = bitonicClean(hi0);
+    *b1 = bitonicClean(hi1);
+}
+
+void smallSort(int a[], int n) {
+    int block[SMALL_SORT_MAX];
+    for (int i = 0; i < SMALL_SORT_MAX; i++) {
+        block[i] = (i < n) ? a[i] : INT_MAX;
+    }
+    __m128i r0 = _mm_loadu_si128((__m128i *)&block[0]);
+    __m128i r1 = _mm_loadu_si128((__m128i *)&block[4]);
+    __m128i r2 = _mm_loadu_si128((__m128i *)&block[8]);
+    __m128i r3 = _mm_loadu_si128((__m128i *)&block[12]);
+
+    // Sort the columns
+    compareExchange(&r0, &r1);
+    compareExchange(&r2, &r3);
+    compareExchange(&r0, &r2);
+    compareExchange(&r1, &r3);
+    compareExchange(&r1, &r2);
+
+    // Transpose, so that each vector holds one sorted column
+    __m128i t0 = _mm_unpacklo_epi32(r0, r1), t1 = _mm_unpackhi_epi32(r0, r1);
+    __m128i t2 = _mm_unpacklo_epi32(r2, r3), t3 = _mm_unpackhi_epi32(r2, r3);
+    r0 = _mm_unpacklo_epi64(t0, t2);
+    r1 = _mm_unpackhi_epi64(t0, t2);
+    r2 = _mm_unpacklo_epi64(t1, t3);
+    r3 = _mm_unpackhi_epi64(t1, t3);
+
+    merge4(&r0, &r1);
+    merge4(&r2, &r3);
+    merge8(&r0, &r1, &r2, &r3);
+
+    _mm_storeu_si128((__m128i *)&block[0], r0);
+    _mm_storeu_si128((__m128i *)&block[4], r1);
+    _mm_storeu_si128((__m128i *)&block[8], r2);
+    _mm_storeu_si128((__m128i *)&block[12], r3);
+    memcpy(a, block, n * sizeof(int));
+}
+
+#else
+
+void smallSort(int a[], int n) {
+    for (int i = 1; i < n; i++) {
+        int x = a[i];
+        int j = i;
+        for (; j > 0 && a[j - 1] > x; j--)
+            a[j] = a[j - 1];
+        a[j] = x;
+    }
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+// Parallel Merge Sort
+// -----------------------------------------------------------------------------
+
+// Returns how many of the first k merged values come from a, taking from
+// a first on ties
+static long coRank(const int *a, long na, const int *b, long nb, long k) {
+    long lo = (k > nb) ? k - nb : 0;
+    long hi = (k < na) ? k : na;
+    while (lo < hi) {
+        long mid = lo + (hi - lo) / 2;
+        if (a[mid] <= b[k - mid - 1])
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+// Stably merges a[0..na-1] and b[0..nb-1] into out
+static void merge(const int *a, long na, const int *b, long nb, int *out) {
+    long i = 0, j = 0, k = 0;
+    while (i < na && j < nb) {
+        out[k++] = (b[j] < a[i]) ? b[j++] : a[i++];
+    }
+    memcpy(out + k, a + i, (na - i) * sizeof(int));
+    memcpy(out + k + na - i, b + j, (nb - j) * sizeof(int));
+}
+
+// Sorts a[0..n-1] using tmp[0..n-1] as scratch: smallSort blocks, then
+// bottom-up merge passes back and forth between a and tmp
+static void mergeSort(int *a, long n, int *tmp) {
+    for (long i = 0; i < n; i += SMALL_SORT_MAX) {
+        smallSort(a + i, (n - i < SMALL_SORT_MAX) ? n - i : SMALL_SORT_MAX);
+    }
+    int *from = a, *to = tmp;
+    for (long width = SMALL_SORT_MAX; width < n; width *= 2) {
+        for (long lo = 0; lo < n; lo += 2 * width) {
+            long mid = (lo + width < n) ? lo + width : n;
+            long hi = (lo + 2 * width < n) ? lo + 2 * width : n;
+            merge(from + lo, mid - lo, from + mid, hi - mid, to + lo);
+        }
+        int *swap = from;
+        from = to;
+        to = swap;
+    }
+    if (from != a) memcpy(a, from, n * sizeof(int));
+}
+
+// One thread's share of a round: either sorting a slice, or producing
+// out[outLo..outHi) of the merge of a and b
+struct job {
+    int *a, *b, *out;
+    long na, nb;
+    long outLo, outHi;
+};
+
+static void *sortJob(void *arg) {
+    struct job *j = arg;
+    mergeSort(j->a, j->na, j->out);
+    return NULL;
+}
+
+static void *mergeJob(void *arg) {
+    struct job *j = arg;
+    long i0 = coRank(j->a, j->na, j->b, j->nb, j->outLo);
+    long i1 = coRank(j->a, j->na, j->b, j->nb, j->outHi);
+    long k0 = j->outLo - i0, k1 = j->outHi - i1;
+    merge(j->a + i0, i1 - i0, j->b + k0, k1 - k0, j->out + j->outLo);
+    return NULL;
+}
+
+static void runJobs(void *(*fn)(void *), struct job *jobs, int njobs) {
+    pthread_t *tids = allocate(njobs * sizeof(pthread_t));
+    for (int i = 1; i < njobs; i++) {
+        if (pthread_create(&tids[i], NULL, fn, &jobs[i]) != 0) {
+            perror("pthread_create failed");
+            exit(EXIT_FAILURE);
+        }
+    }
+    fn(&jobs[0]);
+    for (int i = 1; i < njobs; i++) {
+        pthread_join(tids[i], NULL);
+    }
+    free(tids);
+}
+
+void parallelSort(int a[], int n, int nthreads) {
+    if (nthreads < 1) nthreads = 1;
+    if (n < 2 * SMALL_SORT_MAX * nthreads) nthreads = 1;
+    int *tmp = allocate(n * sizeof(int));
+    // A round can have one more job than threads: a run with no partner
+    struct job *jobs = allocate((nthreads + 1) * sizeof(struct job));
+
+    // Slice boundaries: slice s is [bounds[s], bounds[s + 1])
+    long *bounds = allocate((nthreads + 1) * sizeof(long));
+    for (int s = 0; s <= nthreads; s++) {
+        bounds[s] = (long)n * s / nthreads;
+    }
+    for (int s = 0; s < nthreads; s++) {
+        jobs[s] = (struct job){ a + bounds[s], NULL, tmp + bounds[s],
+                                bounds[s + 1] - bounds[s], 0, 0, 0 };
+    }
+    runJobs(sortJob, jobs, nthreads);
+
+    // Merge neighbouring runs until one is left. Each merge gets an equal
+    // share of the threads, which split its output evenly between them
+    int *from = a, *to = tmp;
+    for (int runs = nthreads, step = 1; runs > 1; runs = (runs + 1) / 2,
+         step *= 2) {
+        int njobs = 0;
+        int pairs = runs / 2;
+        int share = nthreads / pairs;
+        for (int s = 0; s < nthreads; s += 2 * step) {
+            long lo = bounds[s];
+            long mid = bounds[(s + step < nthreads) ? s + step : nthreads];
+            long hi = bounds[(s + 2 * step < nthreads) ? s + 2 * step
+                                                       : nthreads];
+            int parts = (mid == hi) ? 1 : share;
+            for (int p = 0; p < parts; p++) {
+                jobs[njobs++] = (struct job){
+                    from + lo, from + mid, to + lo, mid - lo, hi - mid,
+                    (hi - lo) * p / parts, (hi - lo) * (p + 1) / parts
+                };
+            }
+        }
+        runJobs(mergeJob, jobs, njobs);
+        int *swap = from;
+        from = to;
+        to = swap;
+    }
+    if (from != a) memcpy(a, from, n * sizeof(int));
+
+    free(bounds);
+    free(jobs);
+    free(tmp);
+}
@@ -0,0 +1,21 @@
+#ifndef SORT_H
+#define SORT_H
+
+// Largest input that smallSort accepts
+#define SMALL_SORT_MAX 16
+
+// Sorts a[0..n-1] into ascending order with an LSD radix sort, one byte
+// per pass. O(n) time, O(n) extra memory. Not in-place, but stable
+void radixSort(int a[], int n);
+
+// Sorts a[0..n-1] with a fixed sorting network, vectorised where the CPU
+// allows. Assumes that n <= SMALL_SORT_MAX
+void smallSort(int a[], int n);
+
+// Sorts a[0..n-1] with a merge sort on nthreads threads: each thread sorts
+// one slice, starting from smallSort blocks, then the slices are merged
+// pairwise, each merge itself split across the threads. Stable, O(n) extra
+// memory
+void parallelSort(int a[], int n, int nthreads);
+
+#endif // SORT_H
@@ -0,0 +1,92 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "Sort.h"
+
+// -----------------------------------------------------------------------------
+// Sorting benchmark: qsort against radixSort and parallelSort.
+//
+// Usage: ./SortBench [size] [maxThreads]
+// Sorts the same random ints (10^8 by default) with each algorithm, and
+// parallelSort on 1, 2, 4, ... maxThreads threads (the number of online
+// CPUs by default). Every result is checked against qsort's.
+// -----------------------------------------------------------------------------
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int compare_ints(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+static void *allocate(size_t bytes) {
+    void *p = malloc(bytes);
+    if (p == NULL) {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+static void report(const char *name, double secs, double base, bool ok) {
+    printf("%-18s  %8.3f  %7.2fx  %s\n", name, secs, base / secs,
+           ok ? "ok" : "WRONG");
+}
+
+int main(int argc, char *argv[]) {
+    int size = (argc > 1) ? atoi(argv[1]) : 100000000;
+    int maxThreads = (argc > 2) ? atoi(argv[2])
+                                : (int)sysconf(_SC_NPROCESSORS_ONLN);
+
+    int *original = allocate(size * sizeof(int));
+    int *expected = allocate(size * sizeof(int));
+    int *work = allocate(size * sizeof(int));
+    unsigned state = 2521;
+    for (int i = 0; i < size; i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        original[i] = (int)state;
+    }
+
+    printf("%d random ints\n", size);
+    printf("algorithm               secs  vs qsort\n");
+
+    memcpy(expected, original, size * sizeof(int));
+    double start = now();
+    qsort(expected, size, sizeof(int), compare_ints);
+    double base = now() - start;
+    report("qsort", base, base, true);
+
+    memcpy(work, original, size * sizeof(int));
+    start = now();
+    radixSort(work, size);
+    double secs = now() - start;
+    report("radixSort", secs, base,
+           memcmp(work, expected, size * sizeof(int)) == 0);
+
+    for (int t = 1; t <= maxThreads; t *= 2) {
+        char name[32];
+        snprintf(name, sizeof(name), "parallelSort x%d", t);
+        memcpy(work, original, size * sizeof(int));
+        start = now();
+        parallelSort(work, size, t);
+        secs = now() - start;
+        report(name, secs, base,
+               memcmp(work, expected, size * sizeof(int)) == 0);
+    }
+
+    free(work);
+    free(expected);
+    free(original);
+    return 0;
+}
@@ -0,0 +1,174 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <limits.h>
+
+#include "Sort.h"
+
+// ANSI colour codes
+#define RESET   "\033[0m"
+#define GREEN   "\033[32m"
+#define RED     "\033[31m"
+
+// -----------------------------------------------------------------------------
+// Test Suite Helper Functions
+// -----------------------------------------------------------------------------
+static void run_test(const char *test_name, bool expected, bool result) {
+    if (expected == result) {
+        printf("%sTest %s: PASSED%s\n", GREEN, test_name, RESET);
+    } else {
+        printf("%sTest %s: FAILED (expected %d, got %d)%s\n", RED, test_name, expected, result, RESET);
+    }
+}
+
+static void print_test_suite_header(const char *suite_name) {
+    printf("\nTest Suite: %s\n", suite_name);
+    printf("-----------------------\n");
+}
+
+static int compare_ints(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+// Fills arr with random values; with a small range there are many duplicates
+static void fill_random(int arr[], int size, int range) {
+    for (int i = 0; i < size; i++) {
+        unsigned r = ((unsigned)rand() << 16) ^ (unsigned)rand();
+        arr[i] = (range > 0) ? (int)(r % range) : (int)r;
+    }
+}
+
+// Sorts a copy of arr with sort and with qsort, and compares them
+static bool sorts_like_qsort(int arr[], int size, int nthreads,
+                             void (*sort)(int[], int),
+                             void (*psort)(int[], int, int)) {
+    int *expected = malloc((size + 1) * sizeof(int));
+    int *actual = malloc((size + 1) * sizeof(int));
+    if (!expected || !actual) {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(expected, arr, size * sizeof(int));
+    memcpy(actual, arr, size * sizeof(int));
+    qsort(expected, size, sizeof(int), compare_ints);
+    if (sort != NULL)
+        sort(actual, size);
+    else
+        psort(actual, size, nthreads);
+    bool same = memcmp(expected, actual, size * sizeof(int)) == 0;
+    free(expected);
+    free(actual);
+    return same;
+}
+
+// -----------------------------------------------------------------------------
+// Test Cases
+// -----------------------------------------------------------------------------
+
+// Test 1: smallSort on every size, with random values and duplicates
+static void test_small_sort(void) {
+    print_test_suite_header("smallSort");
+    int arr[SMALL_SORT_MAX];
+    bool ok = true;
+    for (int trial = 0; trial < 2000; trial++) {
+        int size = trial % (SMALL_SORT_MAX + 1);
+        fill_random(arr, size, (trial % 2) ? 0 : 5);
+        if (!sorts_like_qsort(arr, size, 1, smallSort, NULL))
+            ok = false;
+    }
+    run_test("Random sizes 0..16", true, ok);
+
+    int extremes[] = {INT_MAX, 0, INT_MIN, -1, 1, INT_MAX, INT_MIN};
+    run_test("Extreme values", true,
+             sorts_like_qsort(extremes, 7, 1, smallSort, NULL));
+}
+
+// Test 2: radixSort, including negative numbers
+static void test_radix_sort(void) {
+    print_test_suite_header("radixSort");
+    int extremes[] = {5, INT_MIN, -5, INT_MAX, 0, -1, 1, INT_MIN, 256,
+                      -256, 65536, -65536, 1 << 24, -(1 << 24), 7, 3,
+                      INT_MAX, 2, -2};
+    run_test("Extreme values", true,
+             sorts_like_qsort(extremes, 19, 1, radixSort, NULL));
+
+    int size = 100000;
+    int *arr = malloc(size * sizeof(int));
+    if (!arr) {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    fill_random(arr, size, 0);
+    for (int i = 0; i < size; i += 2)
+        arr[i] = -arr[i];
+    run_test("Random values", true,
+             sorts_like_qsort(arr, size, 1, radixSort, NULL));
+
+    // Only the low byte differs, so three passes are skipped
+    for (int i = 0; i < size; i++)
+        arr[i] = 0x12345600 + (i * 37) % 256;
+    run_test("Skipped passes", true,
+             sorts_like_qsort(arr, size, 1, radixSort, NULL));
+    free(arr);
+}
+
+// Test 3: parallelSort with various thread counts and sizes
+static void test_parallel_sort(void) {
+    print_test_suite_header("parallelSort");
+    int empty[1] = {0};
+    run_test("Empty array", true,
+             sorts_like_qsort(empty, 0, 4, NULL, parallelSort));
+
+    int size = 300001;
+    int *arr = malloc(size * sizeof(int));
+    if (!arr) {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    fill_random(arr, size, 0);
+    int threads[] = {1, 2, 3, 4, 7, 8};
+    bool ok = true;
+    for (int i = 0; i < 6; i++) {
+        if (!sorts_like_qsort(arr, size, threads[i], NULL, parallelSort))
+            ok = false;
+    }
+    run_test("Random values, 1 to 8 threads", true, ok);
+
+    fill_random(arr, size, 10);
+    run_test("Many duplicates", true,
+             sorts_like_qsort(arr, size, 4, NULL, parallelSort));
+
+    for (int i = 0; i < size; i++)
+        arr[i] = size - i;
+    run_test("Reverse sorted", true,
+             sorts_like_qsort(arr, size, 5, NULL, parallelSort));
+
+    ok = true;
+    for (int n = 1; n < 200; n += 13) {
+        fill_random(arr, n, 50);
+        if (!sorts_like_qsort(arr, n, 4, NULL, parallelSort))
+            ok = false;
+    }
+    run_test("Small arrays", true, ok);
+    free(arr);
+}
+
+// -----------------------------------------------------------------------------
+// Run All Tests
+// -----------------------------------------------------------------------------
+static void run_tests(void) {
+    srand(2521);
+    test_small_sort();
+    test_radix_sort();
+    test_parallel_sort();
+}
+
+// -----------------------------------------------------------------------------
+// Main Function
+// -----------------------------------------------------------------------------
+int main(void) {
+    run_tests();
+    return 0;
+}
@@ -3,23 +3,18 @@
 #include <string.h>
 #include <stdbool.h>
 
+#include "ItemSort.h"
+
 // ANSI colour codes
 #define RESET   "\033[0m"
 #define GREEN   "\033[32m"
 #define RED     "\033[31m"
 
-// -----------------------------------------------------------------------------
-// Data Structure Declaration
-// -----------------------------------------------------------------------------
-typedef struct {
-    int a;
-    int b;
-} Item;
-
 // -----------------------------------------------------------------------------
 // Function Prototype for the candidate's implementation
 // -----------------------------------------------------------------------------
 bool isStableSort(Item original[], Item sorted[], int size);
+bool verifyStableSort(Item original[], Item sorted[], int size);
 
 // -----------------------------------------------------------------------------
 // Test Suite Helper Functions
@@ -48,6 +43,8 @@ static void test_empty_array(void) {
     Item *sorted = NULL;
     bool result = isStableSort(original, sorted, 0);
     run_test("Empty array", true, result);
+    run_test("Empty array (linear)", true,
+             verifyStableSort(original, sorted, 0));
 }
 
 // Test 2: Single element array should be considered stable.
@@ -57,6 +54,8 @@ static void test_single_element(void) {
     Item sorted[1] = { {5, 100} };
     bool result = isStableSort(original, sorted, 1);
     run_test("Single element", true, result);
+    run_test("Single element (linear)", true,
+             verifyStableSort(original, sorted, 1));
 }
 
 // Test 3: Stable sort on an array with duplicate keys.
@@ -69,6 +68,8 @@ static void test_stable_duplicates(void) {
     int size = sizeof(original) / sizeof(original[0]);
     bool result = isStableSort(original, sorted, size);
     run_test("Stable sort with duplicates", true, result);
+    run_test("Stable sort with duplicates (linear)", true,
+             verifyStableSort(original, sorted, size));
 }
 
 // Test 4: Unstable sort on an array with duplicate keys.
@@ -81,6 +82,8 @@ static void test_unstable_duplicates(void) {
     int size = sizeof(original) / sizeof(original[0]);
     bool result = isStableSort(original, sorted, size);
     run_test("Unstable sort with duplicates", false, result);
+    run_test("Unstable sort with duplicates (linear)", false,
+             verifyStableSort(original, sorted, size));
 }
 
 // Test 5: Sorted array with unique keys.
@@ -93,6 +96,8 @@ static void test_unique_keys(void) {
     int size = sizeof(original) / sizeof(original[0]);
     bool result = isStableSort(original, sorted, size);
     run_test("Unique keys sorted", true, result);
+    run_test("Unique keys sorted (linear)", true,
+             verifyStableSort(original, sorted, size));
 }
 
 // Test 6: Larger array with mixed duplicates (stable version)
@@ -108,6 +113,8 @@ static void test_large_stable(void) {
     int size = sizeof(original) / sizeof(original[0]);
     bool result = isStableSort(original, sorted, size);
     run_test("Larger array stable sort", true, result);
+    run_test("Larger array stable sort (linear)", true,
+             verifyStableSort(original, sorted, size));
 }
 
 // Test 7: Larger array with mixed duplicates (unstable version)
@@ -123,6 +130,159 @@ static void test_large_unstable(void) {
     int size = sizeof(original) / sizeof(original[0]);
     bool result = isStableSort(original, sorted, size);
     run_test("Larger array unstable sort", false, result);
+    run_test("Larger array unstable sort (linear)", false,
+             verifyStableSort(original, sorted, size));
+}
+
+// -----------------------------------------------------------------------------
+// Test Cases for the Item sorts in ItemSort.c
+// -----------------------------------------------------------------------------
+
+// Runs the SoA sort on a copy of items split into two arrays, and joins
+// the result back together
+static void sort_as_soa(void (*sort)(int[], int[], int), Item items[], int size) {
+    int *keys = malloc((size + 1) * sizeof(int));
+    int *values = malloc((size + 1) * sizeof(int));
+    if (!keys || !values) {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < size; i++) {
+        keys[i] = items[i].a;
+        values[i] = items[i].b;
+    }
+    sort(keys, values, size);
+    for (int i = 0; i < size; i++) {
+        items[i] = (Item){ keys[i], values[i] };
+    }
+    free(keys);
+    free(values);
+}
+
+// Sorts a copy of original with each of the four Item sorts, and checks
+// every result with isStableSort and for ascending keys
+static bool all_sorts_stable(Item original[], int size) {
+    Item *sorted = malloc((size + 1) * sizeof(Item));
+    if (!sorted) {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    bool ok = true;
+    for (int engine = 0; engine < 4; engine++) {
+        memcpy(sorted, original, size * sizeof(Item));
+        switch (engine) {
+        case 0: itemRadixSort(sorted, size); break;
+        case 1: itemTimSort(sorted, size); break;
+        case 2: sort_as_soa(itemRadixSortSoA, sorted, size); break;
+        case 3: sort_as_soa(itemTimSortSoA, sorted, size); break;
+        }
+        for (int i = 1; i < size; i++) {
+            if (sorted[i - 1].a > sorted[i].a)
+                ok = false;
+        }
+        if (!isStableSort(original, sorted, size)
+            || !verifyStableSort(original, sorted, size))
+            ok = false;
+    }
+    free(sorted);
+    return ok;
+}
+
+// Fills items with keys from key(i) and payloads that are all distinct
+static void fill_items(Item items[], int size, int (*key)(int i)) {
+    for (int i = 0; i < size; i++) {
+        items[i] = (Item){ key(i), i };
+    }
+}
+
+static int random_key(int i) { (void)i; return rand() % 50 - 25; }
+static int ascending_key(int i) { return i / 3; }
+static int descending_key(int i) { return -i / 3; }
+static int sawtooth_key(int i) { return i % 250; }
+static int two_runs_key(int i) { return (i < 1500) ? 2 * i : 2 * (i - 1500) + 1; }
+static int blocks_key(int i) {
+    int j = (i < 1500) ? i : i - 1500;
+    return (j / 10) * 20 + j % 10 + ((i < 1500) ? 0 : 10) - (i % 2) * 5;
+}
+static int wide_key(int i) { return (int)((unsigned)i * 2654435761u); }
+
+// Test 8: Item sorts are stable on many input patterns
+static void test_item_sorts(void) {
+    print_test_suite_header("Item Sorts");
+    int size = 3000;
+    Item *items = malloc(size * sizeof(Item));
+    if (!items) {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    run_test("Empty array", true, all_sorts_stable(items, 0));
+
+    srand(2521);
+    fill_items(items, size, random_key);
+    run_test("Random keys with duplicates", true, all_sorts_stable(items, size));
+    fill_items(items, size, ascending_key);
+    run_test("Ascending keys", true, all_sorts_stable(items, size));
+    fill_items(items, size, descending_key);
+    run_test("Descending keys with duplicates", true, all_sorts_stable(items, size));
+    fill_items(items, size, sawtooth_key);
+    run_test("Sawtooth keys", true, all_sorts_stable(items, size));
+    fill_items(items, size, two_runs_key);
+    run_test("Two interleaving runs", true, all_sorts_stable(items, size));
+    fill_items(items, size, blocks_key);
+    run_test("Interleaving blocks (galloping)", true, all_sorts_stable(items, size));
+    fill_items(items, size, wide_key);
+    run_test("Full-range keys", true, all_sorts_stable(items, size));
+    free(items);
+}
+
+// -----------------------------------------------------------------------------
+// Test Cases for verifyStableSort() on large arrays
+// -----------------------------------------------------------------------------
+
+// Test 9: A million items, too many for isStableSort
+static void test_verify_large(void) {
+    print_test_suite_header("verifyStableSort Large Arrays");
+    int size = 1000000;
+    Item *original = malloc(size * sizeof(Item));
+    Item *sorted = malloc(size * sizeof(Item));
+    if (!original || !sorted) {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    srand(2521);
+    for (int i = 0; i < size; i++) {
+        original[i] = (Item){ rand() % 1000, i };
+    }
+    memcpy(sorted, original, size * sizeof(Item));
+    itemTimSort(sorted, size);
+    run_test("Stable sort", true, verifyStableSort(original, sorted, size));
+
+    // Swap two items with equal keys
+    int i = 0;
+    while (sorted[i].a != sorted[i + 1].a)
+        i++;
+    Item tmp = sorted[i];
+    sorted[i] = sorted[i + 1];
+    sorted[i + 1] = tmp;
+    run_test("Equal keys swapped", false, verifyStableSort(original, sorted, size));
+    sorted[i + 1] = sorted[i];
+    sorted[i] = tmp;
+
+    // Swap two items with different keys, breaking the order
+    tmp = sorted[0];
+    sorted[0] = sorted[size - 1];
+    sorted[size - 1] = tmp;
+    run_test("Out of order", false, verifyStableSort(original, sorted, size));
+    sorted[size - 1] = sorted[0];
+    sorted[0] = tmp;
+
+    // Replace one item with a copy of its neighbour, so the order still
+    // holds but an item is lost
+    sorted[size / 2] = sorted[size / 2 + 1];
+    run_test("Not a permutation", false, verifyStableSort(original, sorted, size));
+
+    free(original);
+    free(sorted);
 }
 
 // -----------------------------------------------------------------------------
@@ -136,6 +296,8 @@ static void run_tests(void) {
     test_unique_keys();
     test_large_stable();
     test_large_unstable();
+    test_item_sorts();
+    test_verify_large();
 }
 
 // -----------------------------------------------------------------------------
@@ -180,3 +342,26 @@ bool isStableSort(Item original[], Item sorted[], int size) {
     }
     return true;
 }
+
+// Checks the same property as isStableSort in O(n): items with equal keys
+// can only be stably sorted one way, so sorted must equal original after
+// a stable radix sort. The one comparison also checks that sorted is in
+// order and is a permutation of original
+bool verifyStableSort(Item original[], Item sorted[], int size) {
+    if (size == 0)
+        return true;
+    Item *expected = malloc(size * sizeof(Item));
+    if (!expected) {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(expected, original, size * sizeof(Item));
+    itemRadixSort(expected, size);
+    bool stable = true;
+    for (int i = 0; i < size && stable; i++) {
+        if (expected[i].a != sorted[i].a || expected[i].b != sorted[i].b)
+            stable = false;
+    }
+    free(expected);
+    return stable;
+}
@@ -3,6 +3,8 @@
 #include <stdbool.h>
 #include <string.h>
 
+#include "NodePool.h"
+
 // ANSI colour codes
 #define RESET   "\033[0m"
 #define GREEN   "\033[32m"
@@ -16,11 +18,15 @@ struct node {
     struct node *next;
 };
 
+// Every node comes from this pool, created on the first create_node
+static NodePool node_pool = NULL;
+
 // -----------------------------------------------------------------------------
 // Function Prototype for the candidate's implementation
 // -----------------------------------------------------------------------------
 struct node *selectionSort(struct node *list);
 struct node *findMin(struct node *list);
+struct node *mergeSort(struct node *list);
 
 // -----------------------------------------------------------------------------
 // Helper Functions for Linked List Management
@@ -28,11 +34,8 @@ struct node *findMin(struct node *list);
 
 // Create a new node with the given value.
 struct node *create_node(int value) {
-    struct node *new_node = malloc(sizeof(struct node));
-    if (!new_node) {
-        perror("malloc failed");
-        exit(EXIT_FAILURE);
-    }
+    if (node_pool == NULL) node_pool = NodePoolNew(sizeof(struct node));
+    struct node *new_node = NodePoolAlloc(node_pool);
     new_node->value = value;
     new_node->next = NULL;
     return new_node;
@@ -60,7 +63,7 @@ void free_list(struct node *head) {
     while (head) {
         struct node *temp = head;
         head = head->next;
-        free(temp);
+        NodePoolRelease(node_pool, temp);
     }
 }
 
@@ -173,6 +176,90 @@ static void test_duplicates_list(void) {
     free_list(sorted_list);
 }
 
+// -----------------------------------------------------------------------------
+// Test Cases for mergeSort()
+// -----------------------------------------------------------------------------
+
+// Returns the length of the linked list.
+static int list_length(struct node *head) {
+    int length = 0;
+    for (; head != NULL; head = head->next)
+        length++;
+    return length;
+}
+
+// Test 7: mergeSort on small lists
+static void test_merge_sort_small(void) {
+    print_test_suite_header("mergeSort Small Lists");
+    run_test("Empty list sorted", true, mergeSort(NULL) == NULL);
+
+    int arr[] = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3};
+    int size = sizeof(arr) / sizeof(arr[0]);
+    struct node *list = create_list_from_array(arr, size);
+    struct node *sorted_list = mergeSort(list);
+    run_test("Unsorted list sorted", true,
+             is_sorted(sorted_list) && list_length(sorted_list) == size);
+    free_list(sorted_list);
+
+    int rev[] = {5, 4, 3, 2, 1};
+    list = create_list_from_array(rev, 5);
+    struct node *last = list->next->next->next->next;
+    sorted_list = mergeSort(list);
+    run_test("Reverse list relinked, not copied", true,
+             is_sorted(sorted_list) && sorted_list == last);
+    free_list(sorted_list);
+}
+
+// Test 8: mergeSort keeps equal values in their original order
+static void test_merge_sort_stable(void) {
+    print_test_suite_header("mergeSort Stability");
+    int arr[] = {2, 1, 2, 0, 1, 2, 0, 1};
+    int size = sizeof(arr) / sizeof(arr[0]);
+    struct node *list = create_list_from_array(arr, size);
+    struct node *nodes[8];
+    int i = 0;
+    for (struct node *curr = list; curr != NULL; curr = curr->next)
+        nodes[i++] = curr;
+    // Sorted order, by original position
+    int expected[] = {3, 6, 1, 4, 7, 0, 2, 5};
+    struct node *sorted_list = mergeSort(list);
+    bool stable = true;
+    i = 0;
+    for (struct node *curr = sorted_list; curr != NULL; curr = curr->next) {
+        if (i >= size || curr != nodes[expected[i]]) stable = false;
+        i++;
+    }
+    run_test("Equal values keep their order", true, stable && i == size);
+    free_list(sorted_list);
+}
+
+// Test 9: mergeSort on long random and nearly sorted lists
+static void test_merge_sort_large(void) {
+    print_test_suite_header("mergeSort Large Lists");
+    int size = 200000;
+    int *arr = malloc(size * sizeof(int));
+    if (!arr) {
+        perror("malloc failed");
+        exit(EXIT_FAILURE);
+    }
+    srand(2521);
+    for (int i = 0; i < size; i++)
+        arr[i] = rand() % 1000;
+    struct node *sorted_list = mergeSort(create_list_from_array(arr, size));
+    run_test("Random list sorted", true,
+             is_sorted(sorted_list) && list_length(sorted_list) == size);
+    free_list(sorted_list);
+
+    // Ascending, with every 1000th value out of place
+    for (int i = 0; i < size; i++)
+        arr[i] = (i % 1000 == 999) ? -i : i;
+    sorted_list = mergeSort(create_list_from_array(arr, size));
+    run_test("Nearly sorted list sorted", true,
+             is_sorted(sorted_list) && list_length(sorted_list) == size);
+    free_list(sorted_list);
+    free(arr);
+}
+
 // -----------------------------------------------------------------------------
 // Run All Tests
 // -----------------------------------------------------------------------------
@@ -183,6 +270,9 @@ static void run_tests(void) {
     test_sorted_list();
     test_reverse_list();
     test_duplicates_list();
+    test_merge_sort_small();
+    test_merge_sort_stable();
+    test_merge_sort_large();
 }
 
 // -----------------------------------------------------------------------------
@@ -190,6 +280,7 @@ static void run_tests(void) {
 // -----------------------------------------------------------------------------
 int main(void) {
     run_tests();
+    if (node_pool != NULL) NodePoolFree(node_pool);
     return 0;
 }
 
@@ -220,3 +311,66 @@ struct node *findMin(struct node *list) {
     }
     return curr_smallest;
 }
+
+// Detaches the ascending run at the front of *list and returns it,
+// leaving *list pointing at the node after the run
+static struct node *takeRun(struct node **list) {
+    struct node *run = *list;
+    struct node *curr = run;
+    while (curr->next != NULL && curr->value <= curr->next->value)
+        curr = curr->next;
+    *list = curr->next;
+    curr->next = NULL;
+    return run;
+}
+
+// Merges two sorted lists by relinking their nodes, taking from a on ties
+// so that the sort is stable. Sets *tail to the last node of the result
+static struct node *merge(struct node *a, struct node *b, struct node **tail) {
+    struct node head;
+    struct node *last = &head;
+    while (a != NULL && b != NULL) {
+        if (b->value < a->value) {
+            last->next = b;
+            b = b->next;
+        } else {
+            last->next = a;
+            a = a->next;
+        }
+        last = last->next;
+    }
+    last->next = (a != NULL) ? a : b;
+    while (last->next != NULL)
+        last = last->next;
+    *tail = last;
+    return head.next;
+}
+
+// Sorts a linked list by relinking its nodes: a bottom-up natural merge
+// sort. Each pass merges neighbouring ascending runs in pairs, halving the
+// number of runs, until one remains. O(n log r) for a list with r runs,
+// so O(n) when already sorted, with O(1) extra memory
+struct node *mergeSort(struct node *list) {
+    if (list == NULL)
+        return NULL;
+    for (;;) {
+        struct node *sorted = NULL;
+        struct node *tail = NULL;
+        int merges = 0;
+        while (list != NULL) {
+            struct node *a = takeRun(&list);
+            struct node *b = (list != NULL) ? takeRun(&list) : NULL;
+            struct node *mergedTail;
+            struct node *merged = merge(a, b, &mergedTail);
+            if (tail == NULL)
+                sorted = merged;
+            else
+                tail->next = merged;
+            tail = mergedTail;
+            merges++;
+        }
+        list = sorted;
+        if (merges == 1)
+            return list;
+    }
+}
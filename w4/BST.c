@@ -0,0 +1,665 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "BST.h"
+#include "BSTInternal.h"
+#include "ThreadPool.h"
+
+// -----------------------------------------------------------------------------
+// BST Function Prototypes and Implementations
+// -----------------------------------------------------------------------------
+
+/*
+ * Function: bstNumNodes
+ * ---------------------
+ * Counts the total number of nodes in a tree.
+ * Every node stores the size of its subtree, so this is O(1).
+ *
+ * t: pointer to the root of the BST.
+ *
+ * returns: the total number of nodes in the tree.
+ */
+int bstNumNodes(struct node *t) {
+    return size(t);
+}
+
+/*
+ * Function: bstCountOdds
+ * ---------------------
+ * Counts the number of nodes in the tree with odd values.
+ * Visits every node in preorder using an explicit stack.
+ *
+ * t: pointer to the root of the BST.
+ *
+ * returns: the number of nodes that have an odd value.
+ */
+int bstCountOdds(struct node *t) {
+    if (t == NULL) return 0;
+    struct nodeStack s;
+    stackInit(&s);
+    stackPush(&s, t, 0);
+    int count = 0;
+    while (s.size > 0) {
+        struct node *n = stackPop(&s).node;
+        if (n->value % 2 == 1)
+            count++;
+        if (n->left != NULL) stackPush(&s, n->left, 0);
+        if (n->right != NULL) stackPush(&s, n->right, 0);
+    }
+    stackFree(&s);
+    return count;
+}
+
+/*
+ * Function: bstCountInternal
+ * ---------------------
+ * Counts the number of internal nodes in a tree.
+ * An internal node is defined as a node with at least one child.
+ * Visits every node in preorder using an explicit stack.
+ *
+ * t: pointer to the root of the BST.
+ *
+ * returns: the number of internal nodes in the tree.
+ */
+int bstCountInternal(struct node *t) {
+    if (t == NULL) return 0;
+    struct nodeStack s;
+    stackInit(&s);
+    stackPush(&s, t, 0);
+    int count = 0;
+    while (s.size > 0) {
+        struct node *n = stackPop(&s).node;
+        if (n->left != NULL || n->right != NULL)
+            count++;
+        if (n->left != NULL) stackPush(&s, n->left, 0);
+        if (n->right != NULL) stackPush(&s, n->right, 0);
+    }
+    stackFree(&s);
+    return count;
+}
+
+/*
+ * Function: bstHeight
+ * ---------------------
+ * Computes the height of a tree.
+ * The height is defined as the length of the longest path from the root to a leaf.
+ * For an empty tree, the height is defined as -1.
+ * Measured from the links rather than the stored heights: every node is
+ * visited with its depth on an explicit stack, and the deepest one wins.
+ *
+ * t: pointer to the root of the BST.
+ *
+ * returns: the height of the tree.
+ */
+int bstHeight(struct node *t) {
+    if (t == NULL) return -1;
+    struct nodeStack s;
+    stackInit(&s);
+    stackPush(&s, t, 0);
+    int deepest = 0;
+    while (s.size > 0) {
+        struct frame f = stackPop(&s);
+        deepest = max(deepest, f.depth);
+        if (f.node->left != NULL) stackPush(&s, f.node->left, f.depth + 1);
+        if (f.node->right != NULL) stackPush(&s, f.node->right, f.depth + 1);
+    }
+    stackFree(&s);
+    return deepest;
+}
+
+/*
+ * Function: bstNodeLevel
+ * ---------------------
+ * Returns the level of the node containing a given key in the BST.
+ * The level of the root is 0. If the key is not found, returns -1.
+ *
+ * t: pointer to the root of the BST.
+ * key: the value to search for.
+ *
+ * returns: the level of the node with the given key, or -1 if not found.
+ */
+int bstNodeLevel(struct node *t, int key) {
+    for (int level = 0; t != NULL; level++) {
+        if (t->value == key) return level;
+        t = (key < t->value) ? t->left : t->right;
+    }
+    return -1;
+}
+
+/*
+ * Function: bstCountGreater
+ * ---------------------
+ * Counts the number of nodes in the BST whose values are greater than a given value.
+ * Walks a single root-to-leaf path: whenever a node is greater than val, it
+ * and its whole right subtree (counted via the stored size) are greater.
+ * O(height).
+ *
+ * t: pointer to the root of the BST.
+ * val: the value to compare.
+ *
+ * returns: the number of nodes with values greater than val.
+ */
+int bstCountGreater(struct node *t, int val) {
+    int count = 0;
+    while (t != NULL) {
+        if (t->value <= val) {
+            t = t->right;
+        } else {
+            count += 1 + size(t->right);
+            t = t->left;
+        }
+    }
+    return count;
+}
+
+/*
+ * Function: bstRank
+ * ---------------------
+ * Counts the number of nodes in the BST whose values are less than a given
+ * value, i.e. the position val would have in sorted order. O(height).
+ *
+ * t: pointer to the root of the BST.
+ * val: the value to compare.
+ *
+ * returns: the number of nodes with values less than val.
+ */
+int bstRank(struct node *t, int val) {
+    int count = 0;
+    while (t != NULL) {
+        if (t->value < val) {
+            count += 1 + size(t->left);
+            t = t->right;
+        } else {
+            t = t->left;
+        }
+    }
+    return count;
+}
+
+/*
+ * Function: bstSelect
+ * ---------------------
+ * Finds the k-th smallest value in the BST (k = 0 is the minimum).
+ * O(height). Assumes that 0 <= k < bstNumNodes(t).
+ *
+ * t: pointer to the root of the BST.
+ * k: the 0-based position in sorted order.
+ *
+ * returns: the value at position k.
+ */
+int bstSelect(struct node *t, int k) {
+    while (t != NULL) {
+        int leftSize = size(t->left);
+        if (k < leftSize) {
+            t = t->left;
+        } else if (k == leftSize) {
+            return t->value;
+        } else {
+            k -= leftSize + 1;
+            t = t->right;
+        }
+    }
+    fprintf(stderr, "bstSelect: position out of range\n");
+    exit(1);
+}
+
+/*
+ * Function: bstRangeCount
+ * ---------------------
+ * Counts the number of nodes in the BST whose values lie in [lo, hi].
+ * O(height).
+ *
+ * t: pointer to the root of the BST.
+ * lo: the smallest value to count.
+ * hi: the largest value to count.
+ *
+ * returns: the number of nodes with lo <= value <= hi.
+ */
+int bstRangeCount(struct node *t, int lo, int hi) {
+    if (lo > hi) return 0;
+    return size(t) - bstRank(t, lo) - bstCountGreater(t, hi);
+}
+
+// -----------------------------------------------------------------------------
+// Building and Freeing a BST
+// -----------------------------------------------------------------------------
+
+/*
+ * Function: newNode
+ * ---------------------
+ * Creates a new BST node with the given value.
+ *
+ * value: the value to store in the node.
+ *
+ * returns: pointer to the newly allocated node.
+ */
+static struct node *newNode(int value) {
+    struct node *n = malloc(sizeof(struct node));
+    if (n == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    n->value = value;
+    n->height = 0;
+    n->size = 1;
+    n->left = NULL;
+    n->right = NULL;
+    return n;
+}
+
+/*
+ * Function: bstInsert
+ * ---------------------
+ * Inserts a value into the BST.
+ * Records the path down on an explicit stack, links in the new leaf, then
+ * updates heights and sizes on the way back up.
+ *
+ * t: pointer to the root of the BST.
+ * value: the value to insert.
+ *
+ * returns: pointer to the root of the updated BST.
+ */
+struct node *bstInsert(struct node *t, int value) {
+    struct node *leaf = newNode(value);
+    if (t == NULL)
+        return leaf;
+    struct nodeStack path;
+    stackInit(&path);
+    struct node *curr = t;
+    for (;;) {
+        stackPush(&path, curr, 0);
+        struct node **child = (value < curr->value) ? &curr->left
+                                                    : &curr->right;
+        if (*child == NULL) {
+            *child = leaf;
+            break;
+        }
+        curr = *child;
+    }
+    while (path.size > 0)
+        update(stackPop(&path).node);
+    stackFree(&path);
+    return t;
+}
+
+/*
+ * Function: buildBST
+ * ---------------------
+ * Builds a BST from an array of integers.
+ *
+ * vals: pointer to the array of integers.
+ * n: number of elements in the array.
+ *
+ * returns: pointer to the root of the created BST.
+ */
+struct node *buildBST(int *vals, int n) {
+    struct node *root = NULL;
+    for (int i = 0; i < n; i++) {
+        root = bstInsert(root, vals[i]);
+    }
+    return root;
+}
+
+// -----------------------------------------------------------------------------
+// AVL Tree Functions
+// -----------------------------------------------------------------------------
+
+/*
+ * Function: rotateRight
+ * ---------------------
+ * Rotates the subtree rooted at t to the right.
+ *
+ *        t            l
+ *       / \          / \
+ *      l   c   =>   a   t
+ *     / \              / \
+ *    a   b            b   c
+ *
+ * returns: the new root of the subtree.
+ */
+static struct node *rotateRight(struct node *t) {
+    struct node *l = t->left;
+    t->left = l->right;
+    l->right = t;
+    update(t);
+    update(l);
+    return l;
+}
+
+/*
+ * Function: rotateLeft
+ * ---------------------
+ * Rotates the subtree rooted at t to the left (mirror of rotateRight).
+ *
+ * returns: the new root of the subtree.
+ */
+static struct node *rotateLeft(struct node *t) {
+    struct node *r = t->right;
+    t->right = r->left;
+    r->left = t;
+    update(t);
+    update(r);
+    return r;
+}
+
+/*
+ * Function: rebalance
+ * ---------------------
+ * Restores the AVL property at t, assuming both of its subtrees are
+ * already AVL trees whose heights differ by at most 2.
+ *
+ * returns: the new root of the subtree.
+ */
+static struct node *rebalance(struct node *t) {
+    update(t);
+    int balance = height(t->left) - height(t->right);
+    if (balance > 1) {
+        if (height(t->left->left) < height(t->left->right))
+            t->left = rotateLeft(t->left);
+        return rotateRight(t);
+    }
+    if (balance < -1) {
+        if (height(t->right->right) < height(t->right->left))
+            t->right = rotateRight(t->right);
+        return rotateLeft(t);
+    }
+    return t;
+}
+
+/*
+ * Function: avlInsert
+ * ---------------------
+ * Inserts a value into an AVL tree, rotating as needed so that the heights
+ * of every node's subtrees differ by at most one.
+ *
+ * t: pointer to the root of the AVL tree.
+ * value: the value to insert.
+ *
+ * returns: pointer to the root of the updated AVL tree.
+ */
+struct node *avlInsert(struct node *t, int value) {
+    if (t == NULL)
+        return newNode(value);
+    if (value < t->value)
+        t->left = avlInsert(t->left, value);
+    else
+        t->right = avlInsert(t->right, value);
+    return rebalance(t);
+}
+
+/*
+ * Function: avlDelete
+ * ---------------------
+ * Deletes one node containing the given value from an AVL tree, if there
+ * is one, rebalancing on the way back up.
+ *
+ * t: pointer to the root of the AVL tree.
+ * value: the value to delete.
+ *
+ * returns: pointer to the root of the updated AVL tree.
+ */
+struct node *avlDelete(struct node *t, int value) {
+    if (t == NULL)
+        return NULL;
+    if (value < t->value) {
+        t->left = avlDelete(t->left, value);
+    } else if (value > t->value) {
+        t->right = avlDelete(t->right, value);
+    } else if (t->left == NULL || t->right == NULL) {
+        struct node *child = (t->left != NULL) ? t->left : t->right;
+        free(t);
+        return child;
+    } else {
+        // Two children: take the in-order successor's value, then delete
+        // the successor from the right subtree
+        struct node *succ = t->right;
+        while (succ->left != NULL)
+            succ = succ->left;
+        t->value = succ->value;
+        t->right = avlDelete(t->right, succ->value);
+    }
+    return rebalance(t);
+}
+
+/*
+ * Function: buildAVL
+ * ---------------------
+ * Builds an AVL tree from an array of integers.
+ *
+ * vals: pointer to the array of integers.
+ * n: number of elements in the array.
+ *
+ * returns: pointer to the root of the created AVL tree.
+ */
+struct node *buildAVL(int *vals, int n) {
+    struct node *root = NULL;
+    for (int i = 0; i < n; i++) {
+        root = avlInsert(root, vals[i]);
+    }
+    return root;
+}
+
+/*
+ * Function: freeBST
+ * ---------------------
+ * Frees all nodes in the BST.
+ * A node's children are pushed onto an explicit stack before it is freed.
+ *
+ * t: pointer to the root of the BST.
+ */
+void freeBST(struct node *t) {
+    if (t == NULL)
+        return;
+    struct nodeStack s;
+    stackInit(&s);
+    stackPush(&s, t, 0);
+    while (s.size > 0) {
+        struct node *n = stackPop(&s).node;
+        if (n->left != NULL) stackPush(&s, n->left, 0);
+        if (n->right != NULL) stackPush(&s, n->right, 0);
+        free(n);
+    }
+    stackFree(&s);
+}
+
+// -----------------------------------------------------------------------------
+// Bulk Loading
+// -----------------------------------------------------------------------------
+
+// Below this many nodes, a parallel bulk load builds the subtree itself
+// instead of spawning a task for its left half
+#define BULK_CUTOFF 16384
+
+struct bulkArgs {
+    ThreadPool pool;        // NULL for a sequential build
+    const int *sorted;
+    int n;
+    struct node *block;     // where this subtree's preorder layout starts
+    struct node *result;
+};
+
+static int compareInts(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/*
+ * Function: bulkBuild
+ * ---------------------
+ * Builds a perfectly balanced tree from sorted[0..n-1] into block[0..n-1]
+ * in preorder: the middle value's node comes first, followed by the left
+ * subtree's n / 2 nodes and then the right subtree's. Every subtree's
+ * position is fixed by its size alone, so both halves can be built at
+ * the same time and the layout is the same either way.
+ */
+static void bulkBuild(void *arg) {
+    struct bulkArgs *a = arg;
+    if (a->n == 0) {
+        a->result = NULL;
+        return;
+    }
+    int mid = a->n / 2;
+    struct node *t = a->block;
+    struct bulkArgs left = { a->pool, a->sorted, mid, t + 1, NULL };
+    struct bulkArgs right = { a->pool, a->sorted + mid + 1, a->n - mid - 1,
+                              t + 1 + mid, NULL };
+    if (a->pool != NULL && a->n > BULK_CUTOFF) {
+        struct task task;
+        ThreadPoolSpawn(a->pool, &task, bulkBuild, &left);
+        bulkBuild(&right);
+        ThreadPoolJoin(a->pool, &task);
+    } else {
+        bulkBuild(&left);
+        bulkBuild(&right);
+    }
+    t->value = a->sorted[mid];
+    t->left = left.result;
+    t->right = right.result;
+    update(t);
+    a->result = t;
+}
+
+/*
+ * Function: bulkLoad
+ * ---------------------
+ * Shared by bstBulkLoad and bstBulkLoadParallel: sorts a copy of the
+ * input unless it is already in order, optionally removes duplicates,
+ * and builds the tree in one allocation.
+ */
+static struct node *bulkLoad(int *vals, int n, bool dedup, ThreadPool pool) {
+    if (n <= 0) return NULL;
+    int *sorted = malloc(n * sizeof(int));
+    struct node *block = malloc(n * sizeof(struct node));
+    if (sorted == NULL || block == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    memcpy(sorted, vals, n * sizeof(int));
+    bool inOrder = true;
+    for (int i = 1; i < n && inOrder; i++) {
+        if (sorted[i - 1] > sorted[i]) inOrder = false;
+    }
+    if (!inOrder) qsort(sorted, n, sizeof(int), compareInts);
+
+    int m = n;
+    if (dedup) {
+        m = 1;
+        for (int i = 1; i < n; i++) {
+            if (sorted[i] != sorted[m - 1]) sorted[m++] = sorted[i];
+        }
+    }
+
+    struct bulkArgs args = { pool, sorted, m, block, NULL };
+    if (pool != NULL) {
+        ThreadPoolRun(pool, bulkBuild, &args);
+    } else {
+        bulkBuild(&args);
+    }
+    free(sorted);
+    return args.result;
+}
+
+/*
+ * Function: bstBulkLoad
+ * ---------------------
+ * Builds a perfectly balanced BST from an array of integers in O(n) if the
+ * array is already sorted, and O(n log n) otherwise. All nodes share one
+ * allocation with the root at its start, so the tree must be released
+ * with freeBulkBST and must not have nodes inserted or deleted.
+ *
+ * vals: pointer to the array of integers (not modified).
+ * n: number of elements in the array.
+ * dedup: whether to keep only one copy of each value.
+ *
+ * returns: pointer to the root of the created BST.
+ */
+struct node *bstBulkLoad(int *vals, int n, bool dedup) {
+    return bulkLoad(vals, n, dedup, NULL);
+}
+
+/*
+ * Function: bstBulkLoadParallel
+ * ---------------------
+ * Same as bstBulkLoad, but the left and right halves of large subtrees are
+ * built by separate workers of the pool. The resulting tree is identical.
+ *
+ * vals: pointer to the array of integers (not modified).
+ * n: number of elements in the array.
+ * dedup: whether to keep only one copy of each value.
+ * pool: the pool to build on.
+ *
+ * returns: pointer to the root of the created BST.
+ */
+struct node *bstBulkLoadParallel(int *vals, int n, bool dedup,
+                                 ThreadPool pool) {
+    return bulkLoad(vals, n, dedup, pool);
+}
+
+/*
+ * Function: freeBulkBST
+ * ---------------------
+ * Frees a tree built by bstBulkLoad or bstBulkLoadParallel in O(1).
+ *
+ * t: pointer to the root of the BST.
+ */
+void freeBulkBST(struct node *t) {
+    free(t);
+}
+
+// -----------------------------------------------------------------------------
+// Morris In-order Iterator
+// -----------------------------------------------------------------------------
+
+/*
+ * Function: bstIteratorInit
+ * ---------------------
+ * Starts an in-order traversal of the BST.
+ *
+ * it: the iterator to initialise.
+ * t: pointer to the root of the BST.
+ */
+void bstIteratorInit(struct bstIterator *it, struct node *t) {
+    it->curr = t;
+}
+
+/*
+ * Function: bstIteratorNext
+ * ---------------------
+ * Produces the next value of an in-order traversal in O(1) space (Morris
+ * traversal). Before descending into a left subtree, the right link of
+ * that subtree's maximum is pointed back at the current node; coming back
+ * up through that thread removes it again. Each link is followed at most
+ * three times, so a full traversal is O(n).
+ *
+ * it: the iterator.
+ * value: where the next value is stored.
+ *
+ * returns: true if a value was produced, false once the traversal is done.
+ */
+bool bstIteratorNext(struct bstIterator *it, int *value) {
+    struct node *curr = it->curr;
+    while (curr != NULL) {
+        if (curr->left == NULL) {
+            *value = curr->value;
+            it->curr = curr->right;
+            return true;
+        }
+        struct node *pred = curr->left;
+        while (pred->right != NULL && pred->right != curr)
+            pred = pred->right;
+        if (pred->right == NULL) {
+            // First visit: thread the predecessor back to curr
+            pred->right = curr;
+            curr = curr->left;
+        } else {
+            // Left subtree done: remove the thread and visit curr
+            pred->right = NULL;
+            *value = curr->value;
+            it->curr = curr->right;
+            return true;
+        }
+    }
+    it->curr = NULL;
+    return false;
+}
@@ -0,0 +1,94 @@
+#ifndef BST_H
+#define BST_H
+
+#include <stdbool.h>
+
+// Defined in ThreadPool.h, which only bstBulkLoadParallel's callers need
+typedef struct threadPool *ThreadPool;
+
+// BST node
+struct node {
+    int value;
+    int height;     // height of the subtree rooted here (a leaf has 0)
+    int size;       // number of nodes in the subtree rooted here
+    struct node *left;
+    struct node *right;
+};
+
+// In-order iterator that threads the tree instead of using a stack.
+// While it runs, the tree's links are temporarily modified: the traversal
+// must be run to completion before the tree is used or freed.
+struct bstIterator {
+    struct node *curr;
+};
+
+// None of the functions below recurse on tree depth, so degenerate trees
+// are safe (except for the AVL functions, whose depth is O(log n)).
+
+// Counts the total number of nodes in a tree, in O(1)
+int bstNumNodes(struct node *t);
+
+// Counts the number of nodes in the tree with odd values
+int bstCountOdds(struct node *t);
+
+// Counts the number of internal nodes (nodes with at least one child)
+int bstCountInternal(struct node *t);
+
+// Computes the height of a tree (-1 for an empty tree)
+int bstHeight(struct node *t);
+
+// Returns the level of the node containing key (root is 0), or -1
+int bstNodeLevel(struct node *t, int key);
+
+// Counts the number of nodes whose values are greater than val, in O(height)
+int bstCountGreater(struct node *t, int val);
+
+// Counts the number of nodes whose values are less than val, in O(height)
+int bstRank(struct node *t, int val);
+
+// Returns the k-th smallest value (k = 0 is the minimum), in O(height)
+// Assumes that 0 <= k < bstNumNodes(t)
+int bstSelect(struct node *t, int k);
+
+// Counts the number of nodes whose values lie in [lo, hi], in O(height)
+int bstRangeCount(struct node *t, int lo, int hi);
+
+// Inserts a value into the BST without rebalancing
+struct node *bstInsert(struct node *t, int value);
+
+// Builds a BST by inserting vals[0..n-1] in order with bstInsert
+struct node *buildBST(int *vals, int n);
+
+// Inserts a value into an AVL tree, keeping it balanced
+struct node *avlInsert(struct node *t, int value);
+
+// Deletes one instance of value from an AVL tree, keeping it balanced
+struct node *avlDelete(struct node *t, int value);
+
+// Builds an AVL tree by inserting vals[0..n-1] in order with avlInsert
+struct node *buildAVL(int *vals, int n);
+
+// Frees all nodes in the tree
+void freeBST(struct node *t);
+
+// Builds a perfectly balanced BST from vals[0..n-1] in one allocation,
+// in O(n) if vals is already sorted; keeps one copy of each value if
+// dedup is set. The tree must not be modified and is freed by freeBulkBST
+struct node *bstBulkLoad(int *vals, int n, bool dedup);
+
+// Same as bstBulkLoad, building the two halves of large subtrees in
+// parallel on the pool
+struct node *bstBulkLoadParallel(int *vals, int n, bool dedup,
+                                 ThreadPool pool);
+
+// Frees a tree built by bstBulkLoad or bstBulkLoadParallel, in O(1)
+void freeBulkBST(struct node *t);
+
+// Starts an in-order traversal of t
+void bstIteratorInit(struct bstIterator *it, struct node *t);
+
+// Stores the next value in sorted order in *value and returns true, or
+// returns false (restoring the tree) when every value has been produced
+bool bstIteratorNext(struct bstIterator *it, int *value);
+
+#endif // BST_H
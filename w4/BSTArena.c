@@ -0,0 +1,164 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "BSTArena.h"
+#include "BSTInternal.h"
+
+// 2^16 nodes of 16 bytes make a 1 MiB block
+#define BLOCK_BITS 16
+#define BLOCK_NODES (1u << BLOCK_BITS)
+#define BLOCK_MASK (BLOCK_NODES - 1)
+
+// Indices are 32 bits and index 0 is ARENA_NULL
+#define MAX_NODES UINT32_MAX
+
+struct arenaNode {
+    int value;
+    int size;           // number of nodes in the subtree rooted here
+    ArenaNode left;
+    ArenaNode right;
+};
+
+struct bstArena {
+    struct arenaNode **blocks;
+    uint32_t numBlocks;     // blocks allocated so far
+    uint32_t maxBlocks;     // capacity of the blocks table
+    uint32_t next;          // next unused index
+};
+
+// Returns the node with index i, which must not be ARENA_NULL
+static inline struct arenaNode *node(BSTArena a, ArenaNode i) {
+    return &a->blocks[i >> BLOCK_BITS][i & BLOCK_MASK];
+}
+
+static int arenaSize(BSTArena a, ArenaNode t) {
+    if (t == ARENA_NULL) return 0;
+    return node(a, t)->size;
+}
+
+static void outOfMemory(void) {
+    fprintf(stderr, "Memory allocation failed\n");
+    exit(1);
+}
+
+// Adds one block to the arena, doubling the blocks table if it is full
+static void addBlock(BSTArena a) {
+    if (a->numBlocks == a->maxBlocks) {
+        a->maxBlocks *= 2;
+        a->blocks = realloc(a->blocks, a->maxBlocks * sizeof(*a->blocks));
+        if (a->blocks == NULL) outOfMemory();
+    }
+    a->blocks[a->numBlocks] = malloc(BLOCK_NODES * sizeof(struct arenaNode));
+    if (a->blocks[a->numBlocks] == NULL) outOfMemory();
+    a->numBlocks++;
+}
+
+// Bump allocates a leaf holding value
+static ArenaNode newNode(BSTArena a, int value) {
+    if (a->next == MAX_NODES) {
+        fprintf(stderr, "BSTArena: too many nodes\n");
+        exit(1);
+    }
+    if ((a->next >> BLOCK_BITS) == a->numBlocks) addBlock(a);
+    ArenaNode i = a->next++;
+    *node(a, i) = (struct arenaNode){ value, 1, ARENA_NULL, ARENA_NULL };
+    return i;
+}
+
+BSTArena BSTArenaNew(void) {
+    BSTArena a = malloc(sizeof(struct bstArena));
+    if (a == NULL) outOfMemory();
+    a->maxBlocks = 4;
+    a->blocks = malloc(a->maxBlocks * sizeof(*a->blocks));
+    if (a->blocks == NULL) outOfMemory();
+    a->numBlocks = 0;
+    a->next = 1;
+    return a;
+}
+
+void BSTArenaFree(BSTArena a) {
+    for (uint32_t i = 0; i < a->numBlocks; i++) free(a->blocks[i]);
+    free(a->blocks);
+    free(a);
+}
+
+void BSTArenaReset(BSTArena a) {
+    a->next = 1;
+}
+
+// Walks down from t to the insertion point, counting the new node in the
+// size of every subtree on the way, then links it in
+ArenaNode BSTArenaInsert(BSTArena a, ArenaNode t, int value) {
+    ArenaNode leaf = newNode(a, value);
+    if (t == ARENA_NULL) return leaf;
+    ArenaNode curr = t;
+    for (;;) {
+        struct arenaNode *n = node(a, curr);
+        n->size++;
+        ArenaNode *child = (value < n->value) ? &n->left : &n->right;
+        if (*child == ARENA_NULL) {
+            *child = leaf;
+            return t;
+        }
+        curr = *child;
+    }
+}
+
+ArenaNode BSTArenaBuild(BSTArena a, int *vals, int n) {
+    ArenaNode root = ARENA_NULL;
+    for (int i = 0; i < n; i++) {
+        root = BSTArenaInsert(a, root, vals[i]);
+    }
+    return root;
+}
+
+int BSTArenaValue(BSTArena a, ArenaNode t) {
+    return node(a, t)->value;
+}
+
+int BSTArenaNumNodes(BSTArena a, ArenaNode t) {
+    return arenaSize(a, t);
+}
+
+// Walks the tree on an explicit stack: Insert and Build leave sorted input
+// as a chain, too deep to recurse over
+int BSTArenaHeight(BSTArena a, ArenaNode t) {
+    if (t == ARENA_NULL) return -1;
+    struct nodeStack s;
+    stackInit(&s);
+    stackPushIndex(&s, t, 0);
+    int deepest = 0;
+    while (s.size > 0) {
+        struct frame f = stackPop(&s);
+        struct arenaNode *n = node(a, f.index);
+        if (f.depth > deepest) deepest = f.depth;
+        if (n->left != ARENA_NULL) stackPushIndex(&s, n->left, f.depth + 1);
+        if (n->right != ARENA_NULL) stackPushIndex(&s, n->right, f.depth + 1);
+    }
+    stackFree(&s);
+    return deepest;
+}
+
+int BSTArenaNodeLevel(BSTArena a, ArenaNode t, int key) {
+    for (int level = 0; t != ARENA_NULL; level++) {
+        struct arenaNode *n = node(a, t);
+        if (n->value == key) return level;
+        t = (key < n->value) ? n->left : n->right;
+    }
+    return -1;
+}
+
+int BSTArenaCountGreater(BSTArena a, ArenaNode t, int val) {
+    int count = 0;
+    while (t != ARENA_NULL) {
+        struct arenaNode *n = node(a, t);
+        if (n->value <= val) {
+            t = n->right;
+        } else {
+            count += 1 + arenaSize(a, n->right);
+            t = n->left;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,48 @@
+#ifndef BST_ARENA_H
+#define BST_ARENA_H
+
+#include <stdint.h>
+
+// An arena that owns the nodes of any number of BSTs. Nodes are bump
+// allocated from large blocks and refer to their children by 32-bit index
+// instead of by pointer, so a node is 16 bytes rather than the 32 of a
+// struct node, and the whole arena is released at once instead of node
+// by node.
+typedef struct bstArena *BSTArena;
+
+// A node index within an arena; ARENA_NULL is the empty tree
+typedef uint32_t ArenaNode;
+
+#define ARENA_NULL 0
+
+// Creates an empty arena
+BSTArena BSTArenaNew(void);
+
+// Frees the arena and every tree in it
+void BSTArenaFree(BSTArena a);
+
+// Discards every tree in the arena in O(1), keeping its memory for reuse
+void BSTArenaReset(BSTArena a);
+
+// Inserts a value into the BST rooted at t without rebalancing
+ArenaNode BSTArenaInsert(BSTArena a, ArenaNode t, int value);
+
+// Builds a BST by inserting vals[0..n-1] in order with BSTArenaInsert
+ArenaNode BSTArenaBuild(BSTArena a, int *vals, int n);
+
+// Returns the value stored at node t
+int BSTArenaValue(BSTArena a, ArenaNode t);
+
+// Counts the total number of nodes in a tree, in O(1)
+int BSTArenaNumNodes(BSTArena a, ArenaNode t);
+
+// Computes the height of a tree (-1 for an empty tree)
+int BSTArenaHeight(BSTArena a, ArenaNode t);
+
+// Returns the level of the node containing key (root is 0), or -1
+int BSTArenaNodeLevel(BSTArena a, ArenaNode t, int key);
+
+// Counts the number of nodes whose values are greater than val, in O(height)
+int BSTArenaCountGreater(BSTArena a, ArenaNode t, int val);
+
+#endif // BST_ARENA_H
@@ -0,0 +1,152 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "BST.h"
+#include "ThreadPool.h"
+#include "Eytzinger.h"
+#include "BSTArena.h"
+
+// -----------------------------------------------------------------------------
+// BST benchmarks on the same random keys (10^7 by default).
+//
+// Usage: ./BSTBench [keys] [queries]
+// First, building and freeing an unbalanced BST with malloc'd nodes is
+// timed against the same BST in a BSTArena, and against bulk loading a
+// balanced BST (sequentially, and on one worker per online CPU). Then a
+// pointer-based AVL tree and the Eytzinger layout answer the same random
+// queries; throughput is millions of queries per second and the checksums
+// must agree.
+// -----------------------------------------------------------------------------
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// xorshift, so runs are repeatable and cheap next to the searches
+static unsigned rng = 2521;
+
+static int randomKey(int range) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return (int)(rng % (unsigned)range);
+}
+
+static void report(const char *name, double treeSecs, double eytzSecs,
+                   long queries, long treeSum, long eytzSum) {
+    printf("%-13s  %11.2f  %17.2f  %6.2fx  %s\n", name,
+           queries / treeSecs / 1e6, queries / eytzSecs / 1e6,
+           treeSecs / eytzSecs, treeSum == eytzSum ? "ok" : "MISMATCH");
+}
+
+int main(int argc, char *argv[]) {
+    int n = (argc > 1) ? atoi(argv[1]) : 10000000;
+    long queries = (argc > 2) ? atol(argv[2]) : 10000000;
+    int range = (n < 1000000000) ? 2 * n : n;
+
+    int *keys = malloc(n * sizeof(int));
+    int *probes = malloc(queries * sizeof(int));
+    if (keys == NULL || probes == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    for (int i = 0; i < n; i++) keys[i] = randomKey(range);
+    for (long i = 0; i < queries; i++) probes[i] = randomKey(range);
+
+    printf("%d keys, %ld queries\n\n", n, queries);
+
+    double start = now();
+    struct node *bst = buildBST(keys, n);
+    double mallocBuild = now() - start;
+    start = now();
+    freeBST(bst);
+    double mallocFree = now() - start;
+
+    BSTArena arena = BSTArenaNew();
+    start = now();
+    ArenaNode t = BSTArenaBuild(arena, keys, n);
+    double arenaBuild = now() - start;
+    bool sameSize = BSTArenaNumNodes(arena, t) == n;
+    start = now();
+    BSTArenaFree(arena);
+    double arenaFree = now() - start;
+
+    printf("structure       build s    free s\n");
+    printf("BST (malloc)  %9.3f  %8.4f\n", mallocBuild, mallocFree);
+    printf("BST (arena)   %9.3f  %8.4f  %s\n",
+           arenaBuild, arenaFree, sameSize ? "ok" : "MISMATCH");
+
+    start = now();
+    bst = bstBulkLoad(keys, n, false);
+    double bulkBuild = now() - start;
+    sameSize = bstNumNodes(bst) == n;
+    start = now();
+    freeBulkBST(bst);
+    printf("BST (bulk)    %9.3f  %8.4f  %s\n",
+           bulkBuild, now() - start, sameSize ? "ok" : "MISMATCH");
+
+    int threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    ThreadPool pool = ThreadPoolNew(threads);
+    start = now();
+    bst = bstBulkLoadParallel(keys, n, false, pool);
+    bulkBuild = now() - start;
+    sameSize = bstNumNodes(bst) == n;
+    freeBulkBST(bst);
+    ThreadPoolFree(pool);
+    printf("BST (bulk x%d) %9.3f            %s\n",
+           threads, bulkBuild, sameSize ? "ok" : "MISMATCH");
+
+    start = now();
+    struct node *root = buildAVL(keys, n);
+    double treeBuild = now() - start;
+    start = now();
+    Eytzinger e = EytzingerNew(keys, n);
+    double eytzBuild = now() - start;
+
+    printf("AVL           %9.3f\n", treeBuild);
+    printf("Eytzinger     %9.3f\n\n", eytzBuild);
+    printf("query          AVL Mq/s  Eytzinger Mq/s  speedup\n");
+
+    long treeSum = 0, eytzSum = 0;
+    start = now();
+    for (long i = 0; i < queries; i++)
+        treeSum += bstNodeLevel(root, probes[i]) >= 0;
+    double treeSecs = now() - start;
+    start = now();
+    for (long i = 0; i < queries; i++)
+        eytzSum += EytzingerContains(e, probes[i]);
+    report("contains", treeSecs, now() - start, queries, treeSum, eytzSum);
+
+    // The trees have different shapes, so levels differ; checksum the hits
+    treeSum = eytzSum = 0;
+    start = now();
+    for (long i = 0; i < queries; i++)
+        treeSum += bstNodeLevel(root, probes[i]) >= 0;
+    treeSecs = now() - start;
+    start = now();
+    for (long i = 0; i < queries; i++)
+        eytzSum += EytzingerLevel(e, probes[i]) >= 0;
+    report("level", treeSecs, now() - start, queries, treeSum, eytzSum);
+
+    treeSum = eytzSum = 0;
+    start = now();
+    for (long i = 0; i < queries; i++)
+        treeSum += bstCountGreater(root, probes[i]);
+    treeSecs = now() - start;
+    start = now();
+    for (long i = 0; i < queries; i++)
+        eytzSum += EytzingerCountGreater(e, probes[i]);
+    report("countGreater", treeSecs, now() - start, queries, treeSum, eytzSum);
+
+    EytzingerFree(e);
+    freeBST(root);
+    free(probes);
+    free(keys);
+    return 0;
+}
@@ -0,0 +1,129 @@
+#ifndef BST_INTERNAL_H
+#define BST_INTERNAL_H
+
+// Helpers shared by the tree modules in this directory (BST.c, BSTArena.c
+// and ConcurrentBST.c). Not part of any of their interfaces.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "BST.h"
+
+// -----------------------------------------------------------------------------
+// Node Helpers
+// -----------------------------------------------------------------------------
+
+/*
+ * Function: max
+ * ---------------------
+ * Returns the maximum of two integers.
+ *
+ * a: first integer.
+ * b: second integer.
+ *
+ * returns: the larger of a and b.
+ */
+static inline int max(int a, int b) {
+    if (a > b) return a;
+    return b;
+}
+
+/*
+ * Function: height
+ * ---------------------
+ * Returns the stored height of a node, or -1 for an empty tree.
+ */
+static inline int height(struct node *t) {
+    if (t == NULL) return -1;
+    return t->height;
+}
+
+/*
+ * Function: size
+ * ---------------------
+ * Returns the stored subtree size of a node, or 0 for an empty tree.
+ */
+static inline int size(struct node *t) {
+    if (t == NULL) return 0;
+    return t->size;
+}
+
+/*
+ * Function: update
+ * ---------------------
+ * Recomputes a node's stored height and subtree size from its children's.
+ */
+static inline void update(struct node *t) {
+    t->height = 1 + max(height(t->left), height(t->right));
+    t->size = 1 + size(t->left) + size(t->right);
+}
+
+// -----------------------------------------------------------------------------
+// Explicit Stack
+// -----------------------------------------------------------------------------
+
+// Traversals keep their pending nodes in one contiguous buffer instead of
+// on the call stack, so a degenerate tree cannot overflow it. Balanced
+// trees never leave the inline buffer; deeper ones move to the heap and
+// double from there.
+#define INLINE_FRAMES 64
+
+// A pending node and its depth. Pointer-based trees use node; BSTArena
+// uses index, its 32-bit ArenaNode.
+struct frame {
+    union {
+        struct node *node;
+        uint32_t index;
+    };
+    int depth;
+};
+
+struct nodeStack {
+    struct frame *frames;
+    int size;
+    int capacity;
+    struct frame inlineFrames[INLINE_FRAMES];
+};
+
+static inline void stackInit(struct nodeStack *s) {
+    s->frames = s->inlineFrames;
+    s->size = 0;
+    s->capacity = INLINE_FRAMES;
+}
+
+static inline void stackPushFrame(struct nodeStack *s, struct frame f) {
+    if (s->size == s->capacity) {
+        struct frame *frames = malloc(2 * s->capacity * sizeof(struct frame));
+        if (frames == NULL) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(1);
+        }
+        memcpy(frames, s->frames, s->size * sizeof(struct frame));
+        if (s->frames != s->inlineFrames) free(s->frames);
+        s->frames = frames;
+        s->capacity *= 2;
+    }
+    s->frames[s->size++] = f;
+}
+
+static inline void stackPush(struct nodeStack *s, struct node *node,
+                             int depth) {
+    stackPushFrame(s, (struct frame){ .node = node, .depth = depth });
+}
+
+static inline void stackPushIndex(struct nodeStack *s, uint32_t index,
+                                  int depth) {
+    stackPushFrame(s, (struct frame){ .index = index, .depth = depth });
+}
+
+static inline struct frame stackPop(struct nodeStack *s) {
+    return s->frames[--s->size];
+}
+
+static inline void stackFree(struct nodeStack *s) {
+    if (s->frames != s->inlineFrames) free(s->frames);
+}
+
+#endif // BST_INTERNAL_H
@@ -1,6 +1,15 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdatomic.h>
+
+#include <pthread.h>
+
+#include "BST.h"
+#include "ThreadPool.h"
+#include "ConcurrentBST.h"
+#include "Eytzinger.h"
+#include "BSTArena.h"
 
 // -----------------------------------------------------------------------------
 // ANSI Colour Codes for Test Output
@@ -9,218 +18,6 @@
 #define GREEN   "\033[0;32m"
 #define RED     "\033[0;31m"
 
-// -----------------------------------------------------------------------------
-// BST Node Definition
-// -----------------------------------------------------------------------------
-struct node {
-    int value;
-    struct node *left;
-    struct node *right;
-};
-
-// -----------------------------------------------------------------------------
-// Utility Functions
-// -----------------------------------------------------------------------------
-
-/*
- * Function: max
- * ---------------------
- * Returns the maximum of two integers.
- *
- * a: first integer.
- * b: second integer.
- *
- * returns: the larger of a and b.
- */
-int max(int a, int b) {
-    if (a > b) return a;
-    return b;
-}
-
-// -----------------------------------------------------------------------------
-// BST Function Prototypes and Implementations
-// -----------------------------------------------------------------------------
-
-/*
- * Function: bstNumNodes
- * ---------------------
- * Counts the total number of nodes in a tree.
- *
- * t: pointer to the root of the BST.
- *
- * returns: the total number of nodes in the tree.
- */
-int bstNumNodes(struct node *t) {
-    if (t == NULL) return 0;
-    return 1 + bstNumNodes(t->left) + bstNumNodes(t->right);
-}
-
-/*
- * Function: bstCountOdds
- * ---------------------
- * Counts the number of nodes in the tree with odd values.
- *
- * t: pointer to the root of the BST.
- *
- * returns: the number of nodes that have an odd value.
- */
-int bstCountOdds(struct node *t) {
-    if (t == NULL) return 0;
-    int count = bstCountOdds(t->left) + bstCountOdds(t->right);
-    if (t->value % 2 == 1)
-        count++;
-    return count;
-}
-
-/*
- * Function: bstCountInternal
- * ---------------------
- * Counts the number of internal nodes in a tree.
- * An internal node is defined as a node with at least one child.
- *
- * t: pointer to the root of the BST.
- *
- * returns: the number of internal nodes in the tree.
- */
-int bstCountInternal(struct node *t) {
-    if (t == NULL) return 0;
-    if (t->left == NULL && t->right == NULL) return 0;
-    return 1 + bstCountInternal(t->left) + bstCountInternal(t->right);
-}
-
-/*
- * Function: bstHeight
- * ---------------------
- * Computes the height of a tree.
- * The height is defined as the length of the longest path from the root to a leaf.
- * For an empty tree, the height is defined as -1.
- *
- * t: pointer to the root of the BST.
- *
- * returns: the height of the tree.
- */
-int bstHeight(struct node *t) {
-    if (t == NULL) return -1;
-    return 1 + max(bstHeight(t->left), bstHeight(t->right));
-}
-
-/*
- * Function: bstNodeLevel
- * ---------------------
- * Returns the level of the node containing a given key in the BST.
- * The level of the root is 0. If the key is not found, returns -1.
- *
- * t: pointer to the root of the BST.
- * key: the value to search for.
- *
- * returns: the level of the node with the given key, or -1 if not found.
- */
-int bstNodeLevel(struct node *t, int key) {
-    if (t == NULL) return -1;
-    if (t->value == key) return 0;
-    if (key < t->value) {
-        int level = bstNodeLevel(t->left, key);
-        if (level == -1) return -1;
-        return level + 1;
-    } else {
-        int level = bstNodeLevel(t->right, key);
-        if (level == -1) return -1;
-        return level + 1;
-    }
-}
-
-/*
- * Function: bstCountGreater
- * ---------------------
- * Counts the number of nodes in the BST whose values are greater than a given value.
- * This function leverages BST properties to access as few nodes as possible.
- *
- * t: pointer to the root of the BST.
- * val: the value to compare.
- *
- * returns: the number of nodes with values greater than val.
- */
-int bstCountGreater(struct node *t, int val) {
-    if (t == NULL) return 0;
-    if (t->value <= val)
-        return bstCountGreater(t->right, val);
-    return 1 + bstCountGreater(t->left, val) + bstCountGreater(t->right, val);
-}
-
-// -----------------------------------------------------------------------------
-// Helper Functions for Building and Freeing a BST
-// -----------------------------------------------------------------------------
-
-/*
- * Function: newNode
- * ---------------------
- * Creates a new BST node with the given value.
- *
- * value: the value to store in the node.
- *
- * returns: pointer to the newly allocated node.
- */
-static struct node *newNode(int value) {
-    struct node *n = malloc(sizeof(struct node));
-    n->value = value;
-    n->left = NULL;
-    n->right = NULL;
-    return n;
-}
-
-/*
- * Function: bstInsert
- * ---------------------
- * Inserts a value into the BST.
- *
- * t: pointer to the root of the BST.
- * value: the value to insert.
- *
- * returns: pointer to the root of the updated BST.
- */
-static struct node *bstInsert(struct node *t, int value) {
-    if (t == NULL)
-        return newNode(value);
-    if (value < t->value)
-        t->left = bstInsert(t->left, value);
-    else
-        t->right = bstInsert(t->right, value);
-    return t;
-}
-
-/*
- * Function: buildBST
- * ---------------------
- * Builds a BST from an array of integers.
- *
- * vals: pointer to the array of integers.
- * n: number of elements in the array.
- *
- * returns: pointer to the root of the created BST.
- */
-static struct node *buildBST(int *vals, int n) {
-    struct node *root = NULL;
-    for (int i = 0; i < n; i++) {
-        root = bstInsert(root, vals[i]);
-    }
-    return root;
-}
-
-/*
- * Function: freeBST
- * ---------------------
- * Frees all nodes in the BST.
- *
- * t: pointer to the root of the BST.
- */
-static void freeBST(struct node *t) {
-    if (t == NULL)
-        return;
-    freeBST(t->left);
-    freeBST(t->right);
-    free(t);
-}
-
 // -----------------------------------------------------------------------------
 // Test Helper Functions
 // -----------------------------------------------------------------------------
@@ -438,6 +235,530 @@ static void test_bstCountGreater(void) {
     freeBST(root);
 }
 
+// -----------------------------------------------------------------------------
+// Tests for the AVL Tree
+// -----------------------------------------------------------------------------
+
+/*
+ * Function: isAVL
+ * ---------------------
+ * Checks that every node's stored height and size are correct, its subtree heights
+ * differ by at most one, and its values lie within [lo, hi].
+ */
+static bool isAVL(struct node *t, long lo, long hi) {
+    if (t == NULL) return true;
+    if (t->value < lo || t->value > hi) return false;
+    int hl = bstHeight(t->left), hr = bstHeight(t->right);
+    if (hl - hr > 1 || hr - hl > 1) return false;
+    if (t->height != 1 + (hl > hr ? hl : hr)) return false;
+    int sl = t->left ? t->left->size : 0, sr = t->right ? t->right->size : 0;
+    if (t->size != 1 + sl + sr) return false;
+    return isAVL(t->left, lo, t->value) && isAVL(t->right, t->value, hi);
+}
+
+static bool isValidAVL(struct node *t) {
+    return isAVL(t, -2147483648L, 2147483647L);
+}
+
+// Tests for avlInsert
+static void test_avlInsert(void) {
+    print_header("avlInsert Tests");
+
+    // Sorted input stays balanced: 1023 nodes fit in height 9
+    int n = 1023;
+    int *vals = malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) vals[i] = i;
+    struct node *root = buildAVL(vals, n);
+    run_test("Ascending input (height)", bstHeight(root) == 9);
+    run_test("Ascending input (AVL)", isValidAVL(root));
+    run_test("Ascending input (count)", bstNumNodes(root) == n);
+    run_test("Ascending input (level found)", bstNodeLevel(root, 700) >= 0);
+    run_test("Ascending input (countGreater)",
+             bstCountGreater(root, 99) == n - 100);
+    freeBST(root);
+
+    // Descending input
+    for (int i = 0; i < n; i++) vals[i] = n - i;
+    root = buildAVL(vals, n);
+    run_test("Descending input (AVL)",
+             isValidAVL(root) && bstHeight(root) == 9);
+    freeBST(root);
+    free(vals);
+
+    // Duplicates
+    int vals2[] = {5, 5, 5, 5, 5, 5, 5};
+    root = buildAVL(vals2, 7);
+    run_test("Duplicates (AVL)", isValidAVL(root) && bstNumNodes(root) == 7);
+    run_test("Duplicates (countGreater)", bstCountGreater(root, 4) == 7
+                                          && bstCountGreater(root, 5) == 0);
+    freeBST(root);
+}
+
+// Tests for avlDelete
+static void test_avlDelete(void) {
+    print_header("avlDelete Tests");
+
+    // Deleting from an empty tree
+    run_test("Empty tree", avlDelete(NULL, 3) == NULL);
+
+    // Delete every other value from an ascending build
+    int n = 500;
+    int *vals = malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) vals[i] = i;
+    struct node *root = buildAVL(vals, n);
+    for (int i = 0; i < n; i += 2) {
+        root = avlDelete(root, i);
+    }
+    run_test("Half deleted (AVL)", isValidAVL(root));
+    run_test("Half deleted (count)", bstNumNodes(root) == n / 2);
+    run_test("Half deleted (gone)", bstNodeLevel(root, 100) == -1);
+    run_test("Half deleted (kept)", bstNodeLevel(root, 101) >= 0);
+
+    // Deleting a missing value changes nothing
+    root = avlDelete(root, 100);
+    run_test("Missing value", bstNumNodes(root) == n / 2);
+
+    // Delete the rest
+    for (int i = 1; i < n; i += 2) {
+        root = avlDelete(root, i);
+    }
+    run_test("All deleted", root == NULL);
+    free(vals);
+}
+
+// -----------------------------------------------------------------------------
+// Tests for Order Statistics
+// -----------------------------------------------------------------------------
+
+// Tests for bstRank, bstSelect and bstRangeCount
+static void test_orderStatistics(void) {
+    print_header("Order Statistic Tests");
+
+    // Empty tree
+    run_test("Empty tree (rank)", bstRank(NULL, 5) == 0);
+    run_test("Empty tree (range)", bstRangeCount(NULL, 0, 10) == 0);
+
+    // Small tree: (8, 3, 10, 1, 6)
+    int vals1[] = {8, 3, 10, 1, 6};
+    struct node *root = buildBST(vals1, 5);
+    run_test("Small tree (rank of 6)", bstRank(root, 6) == 2);
+    run_test("Small tree (rank of 7)", bstRank(root, 7) == 3);
+    run_test("Small tree (select 0)", bstSelect(root, 0) == 1);
+    run_test("Small tree (select 4)", bstSelect(root, 4) == 10);
+    run_test("Small tree (range 3..8)", bstRangeCount(root, 3, 8) == 3);
+    run_test("Small tree (empty range)", bstRangeCount(root, 8, 3) == 0);
+    freeBST(root);
+
+    // AVL tree with duplicates, then deletions: compare with a scan
+    int n = 300;
+    int *vals = malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) vals[i] = (i * 7) % 100;
+    root = buildAVL(vals, n);
+    for (int i = 0; i < 50; i++) {
+        root = avlDelete(root, i);
+    }
+    int remaining[100] = {0};
+    for (int i = 0; i < n; i++) remaining[vals[i]]++;
+    for (int i = 0; i < 50; i++) remaining[i]--;
+
+    bool ranksOk = isValidAVL(root) && bstNumNodes(root) == n - 50;
+    int below = 0;
+    for (int v = 0; v < 100; v++) {
+        if (bstRank(root, v) != below) ranksOk = false;
+        if (bstCountGreater(root, v) != n - 50 - below - remaining[v])
+            ranksOk = false;
+        for (int j = 0; j < remaining[v]; j++) {
+            if (bstSelect(root, below + j) != v) ranksOk = false;
+        }
+        below += remaining[v];
+    }
+    run_test("AVL with duplicates (rank/select/countGreater)", ranksOk);
+    run_test("AVL with duplicates (range 10..19)",
+             bstRangeCount(root, 10, 19) == 3 * 10 - 10);
+    freeBST(root);
+    free(vals);
+}
+
+// -----------------------------------------------------------------------------
+// Tests for the Eytzinger layout
+// -----------------------------------------------------------------------------
+
+// Tests for EytzingerContains, EytzingerLevel and EytzingerCountGreater
+static void test_eytzinger(void) {
+    print_header("Eytzinger Layout Tests");
+
+    // Empty structure
+    Eytzinger e = EytzingerNew(NULL, 0);
+    run_test("Empty (contains)", !EytzingerContains(e, 5));
+    run_test("Empty (level)", EytzingerLevel(e, 5) == -1);
+    run_test("Empty (countGreater)", EytzingerCountGreater(e, 5) == 0);
+    EytzingerFree(e);
+
+    // 1..7 forms a perfect tree rooted at 4
+    int vals1[] = {7, 3, 5, 1, 6, 2, 4};
+    e = EytzingerNew(vals1, 7);
+    run_test("Perfect tree (root)", EytzingerLevel(e, 4) == 0);
+    run_test("Perfect tree (level 1)", EytzingerLevel(e, 6) == 1);
+    run_test("Perfect tree (leaf)", EytzingerLevel(e, 1) == 2);
+    run_test("Perfect tree (not found)", EytzingerLevel(e, 8) == -1);
+    run_test("Perfect tree (countGreater)", EytzingerCountGreater(e, 2) == 5
+             && EytzingerCountGreater(e, 0) == 7
+             && EytzingerCountGreater(e, 7) == 0);
+    EytzingerFree(e);
+
+    // Values with duplicates: agree with an AVL tree on every query
+    int n = 1000;
+    int *vals = malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) vals[i] = (i * 37) % 600 - 100;
+    e = EytzingerNew(vals, n);
+    struct node *root = buildAVL(vals, n);
+    bool containsOk = true, greaterOk = true;
+    for (int v = -150; v < 550; v++) {
+        if (EytzingerContains(e, v) != (bstNodeLevel(root, v) >= 0))
+            containsOk = false;
+        if (EytzingerCountGreater(e, v) != bstCountGreater(root, v))
+            greaterOk = false;
+    }
+    run_test("Matches AVL (size)", EytzingerSize(e) == bstNumNodes(root));
+    run_test("Matches AVL (contains)", containsOk);
+    run_test("Matches AVL (countGreater)", greaterOk);
+    freeBST(root);
+    EytzingerFree(e);
+    free(vals);
+}
+
+// -----------------------------------------------------------------------------
+// Tests for the node arena
+// -----------------------------------------------------------------------------
+
+// Tests for BSTArena, comparing each tree with the same malloc'd BST
+struct arenaHeightJob {
+    BSTArena a;
+    ArenaNode t;
+    int height;
+};
+
+static void *arenaHeight(void *arg) {
+    struct arenaHeightJob *job = arg;
+    job->height = BSTArenaHeight(job->a, job->t);
+    return NULL;
+}
+
+static void test_bstArena(void) {
+    print_header("BST Arena Tests");
+
+    BSTArena a = BSTArenaNew();
+    run_test("Empty tree", BSTArenaNumNodes(a, ARENA_NULL) == 0
+             && BSTArenaHeight(a, ARENA_NULL) == -1
+             && BSTArenaNodeLevel(a, ARENA_NULL, 3) == -1);
+
+    // Small tree: (8, 3, 10, 1, 6)
+    int vals1[] = {8, 3, 10, 1, 6};
+    ArenaNode t = BSTArenaBuild(a, vals1, 5);
+    run_test("Small tree (root)", BSTArenaValue(a, t) == 8);
+    run_test("Small tree (count)", BSTArenaNumNodes(a, t) == 5);
+    run_test("Small tree (height)", BSTArenaHeight(a, t) == 2);
+    run_test("Small tree (level of 1)", BSTArenaNodeLevel(a, t, 1) == 2);
+    run_test("Small tree (countGreater)",
+             BSTArenaCountGreater(a, t, 5) == 3);
+
+    // Enough nodes to span several blocks, with a second tree alongside
+    int n = 200000;
+    int *vals = malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) vals[i] = (int)((i * 2654435761u) % 100000);
+    ArenaNode big = BSTArenaBuild(a, vals, n);
+    struct node *root = buildBST(vals, n);
+    bool same = BSTArenaNumNodes(a, big) == bstNumNodes(root)
+                && BSTArenaHeight(a, big) == bstHeight(root);
+    for (int v = -1; v <= 100000; v += 7) {
+        if (BSTArenaNodeLevel(a, big, v) != bstNodeLevel(root, v)
+            || BSTArenaCountGreater(a, big, v) != bstCountGreater(root, v))
+            same = false;
+    }
+    run_test("Large tree (matches BST)", same);
+    run_test("Large tree (small tree intact)", BSTArenaNumNodes(a, t) == 5
+             && BSTArenaNodeLevel(a, t, 6) == 2);
+
+    // Reset discards everything; the arena is reused for a fresh tree
+    BSTArenaReset(a);
+    t = BSTArenaBuild(a, vals1, 5);
+    run_test("After reset", BSTArenaNumNodes(a, t) == 5
+             && BSTArenaCountGreater(a, t, 1) == 4);
+
+    // Ascending input builds a chain. Its height is measured on a thread
+    // with a 64 KiB stack, which a frame per level would overflow
+    BSTArenaReset(a);
+    int depth = 20000;
+    for (int i = 0; i < depth; i++) vals[i] = i;
+    struct arenaHeightJob job = { a, BSTArenaBuild(a, vals, depth), 0 };
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, 64 * 1024);
+    pthread_t thread;
+    bool started = pthread_create(&thread, &attr, arenaHeight, &job) == 0;
+    if (started) pthread_join(thread, NULL);
+    pthread_attr_destroy(&attr);
+    run_test("Deep chain (height)", started && job.height == depth - 1);
+    run_test("Deep chain (level of last)",
+             BSTArenaNodeLevel(a, job.t, depth - 1) == depth - 1);
+
+    freeBST(root);
+    BSTArenaFree(a);
+    free(vals);
+}
+
+// -----------------------------------------------------------------------------
+// Tests for Deep Trees and the In-order Iterator
+// -----------------------------------------------------------------------------
+
+// Links 0..n-1 into a right-leaning chain (what ascending input to
+// bstInsert builds, without its O(n^2) cost), setting heights and sizes
+static struct node *buildChain(int n) {
+    struct node *root = NULL;
+    for (int i = n - 1; i >= 0; i--) {
+        struct node *t = malloc(sizeof(struct node));
+        t->value = i;
+        t->left = NULL;
+        t->right = root;
+        t->height = n - 1 - i;
+        t->size = n - i;
+        root = t;
+    }
+    return root;
+}
+
+// Tests that every function copes with a tree far deeper than the call
+// stack would allow if it recursed, and tests bstIteratorNext
+static void test_deepTreesAndIterator(void) {
+    print_header("Deep Tree and Iterator Tests");
+
+    int n = 1000000;
+    struct node *root = buildChain(n);
+    run_test("Chain (height)", bstHeight(root) == n - 1);
+    run_test("Chain (countOdds)", bstCountOdds(root) == n / 2);
+    run_test("Chain (countInternal)", bstCountInternal(root) == n - 1);
+    run_test("Chain (level of last)", bstNodeLevel(root, n - 1) == n - 1);
+    run_test("Chain (countGreater)", bstCountGreater(root, n - 11) == 10);
+
+    root = bstInsert(root, n);
+    run_test("Chain (insert at bottom)", bstNumNodes(root) == n + 1
+             && bstHeight(root) == n && root->height == n);
+
+    struct bstIterator it;
+    bstIteratorInit(&it, root);
+    int value, expected = 0;
+    bool sorted = true;
+    while (bstIteratorNext(&it, &value)) {
+        if (value != expected++) sorted = false;
+    }
+    run_test("Chain (iterator)", sorted && expected == n + 1);
+    freeBST(root);
+
+    // Empty tree
+    bstIteratorInit(&it, NULL);
+    run_test("Iterator (empty tree)", !bstIteratorNext(&it, &value));
+
+    // A tree with left subtrees: sorted output, and the tree is restored
+    int vals[] = {15, 10, 20, 8, 12, 17, 25, 6, 9, 12};
+    int sortedVals[] = {6, 8, 9, 10, 12, 12, 15, 17, 20, 25};
+    root = buildBST(vals, 10);
+    bstIteratorInit(&it, root);
+    bool matches = true;
+    int count = 0;
+    while (bstIteratorNext(&it, &value)) {
+        if (count >= 10 || value != sortedVals[count]) matches = false;
+        count++;
+    }
+    run_test("Iterator (sorted output)", matches && count == 10);
+    run_test("Iterator (tree restored)", bstHeight(root) == 3
+             && bstCountInternal(root) == 5 && bstNodeLevel(root, 9) == 3);
+    freeBST(root);
+}
+
+// -----------------------------------------------------------------------------
+// Tests for Bulk Loading
+// -----------------------------------------------------------------------------
+
+// Checks that t is perfectly balanced: every node's subtrees differ in
+// size by at most one
+static bool isPerfect(struct node *t) {
+    if (t == NULL) return true;
+    int diff = bstNumNodes(t->left) - bstNumNodes(t->right);
+    return diff >= -1 && diff <= 1 && isPerfect(t->left)
+           && isPerfect(t->right);
+}
+
+// Checks that the in-order values of t are expected[0..n-1]
+static bool inOrderIs(struct node *t, int *expected, int n) {
+    struct bstIterator it;
+    bstIteratorInit(&it, t);
+    int value, count = 0;
+    bool ok = true;
+    while (bstIteratorNext(&it, &value)) {
+        if (count >= n || value != expected[count]) ok = false;
+        count++;
+    }
+    return ok && count == n;
+}
+
+// Tests for bstBulkLoad and bstBulkLoadParallel
+static void test_bulkLoad(void) {
+    print_header("Bulk Load Tests");
+
+    run_test("Empty input", bstBulkLoad(NULL, 0, false) == NULL);
+
+    // Unsorted input with duplicates
+    int vals1[] = {8, 3, 10, 3, 1, 6, 8, 14};
+    int sorted1[] = {1, 3, 3, 6, 8, 8, 10, 14};
+    int unique1[] = {1, 3, 6, 8, 10, 14};
+    struct node *root = bstBulkLoad(vals1, 8, false);
+    run_test("Unsorted (in order)", inOrderIs(root, sorted1, 8));
+    run_test("Unsorted (balanced)", isPerfect(root) && root->height == 3
+             && bstHeight(root) == 3 && isValidAVL(root));
+    run_test("Unsorted (input unchanged)", vals1[0] == 8 && vals1[7] == 14);
+    freeBulkBST(root);
+
+    root = bstBulkLoad(vals1, 8, true);
+    run_test("Dedup (in order)", inOrderIs(root, unique1, 6));
+    run_test("Dedup (queries)", bstNumNodes(root) == 6
+             && bstCountGreater(root, 6) == 3 && bstRank(root, 8) == 3);
+    freeBulkBST(root);
+
+    // Large sorted input: the case that degenerates with bstInsert
+    int n = 1000000;
+    int *vals = malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) vals[i] = i / 2;
+    root = bstBulkLoad(vals, n, false);
+    run_test("Sorted (height)", bstHeight(root) == 19 && root->height == 19);
+    run_test("Sorted (balanced)", isPerfect(root));
+    run_test("Sorted (in order)", inOrderIs(root, vals, n));
+
+    // The parallel build lays the nodes out identically
+    ThreadPool pool = ThreadPoolNew(4);
+    struct node *par = bstBulkLoadParallel(vals, n, false, pool);
+    bool same = true;
+    for (int i = 0; i < n; i++) {
+        if (par[i].value != root[i].value || par[i].size != root[i].size
+            || par[i].height != root[i].height
+            || (par[i].left == NULL) != (root[i].left == NULL)
+            || (par[i].left != NULL && par[i].left - par != root[i].left - root))
+            same = false;
+    }
+    run_test("Parallel (same layout)", same);
+    freeBulkBST(par);
+
+    par = bstBulkLoadParallel(vals, n, true, pool);
+    run_test("Parallel (dedup)", bstNumNodes(par) == n / 2 && isPerfect(par)
+             && bstSelect(par, 1234) == 1234);
+    freeBulkBST(par);
+    ThreadPoolFree(pool);
+    freeBulkBST(root);
+    free(vals);
+}
+
+// -----------------------------------------------------------------------------
+// Tests for ConcurrentBST
+// -----------------------------------------------------------------------------
+
+#define CONCURRENT_KEYS 20000
+#define CONCURRENT_READERS 4
+
+struct readerArgs {
+    ConcurrentBST t;
+    atomic_bool *done;
+    bool ok;
+};
+
+// While the writer inserts 0, 1, 2, ... in order, the size a reader sees
+// never shrinks, and every key below a size it has seen is present
+static void *checkGrowing(void *arg) {
+    struct readerArgs *a = arg;
+    int last = 0;
+    while (!atomic_load(a->done)) {
+        int size = ConcurrentBSTSize(a->t);
+        if (size < last) a->ok = false;
+        if (size > 0 && !ConcurrentBSTContains(a->t, size - 1)) a->ok = false;
+        if (ConcurrentBSTCountGreater(a->t, -1) < size) a->ok = false;
+        last = size;
+    }
+    return NULL;
+}
+
+// While the writer deletes the even keys, the odd keys are always present
+static void *checkOddsKept(void *arg) {
+    struct readerArgs *a = arg;
+    for (int i = 1; !atomic_load(a->done); i = (i + 2) % CONCURRENT_KEYS) {
+        if (ConcurrentBSTNodeLevel(a->t, i) < 0) a->ok = false;
+    }
+    return NULL;
+}
+
+// Runs the writer on this thread with readers running check alongside
+static bool runWithReaders(ConcurrentBST t, void *(*check)(void *),
+                           bool deleting) {
+    atomic_bool done = false;
+    pthread_t tids[CONCURRENT_READERS];
+    struct readerArgs args[CONCURRENT_READERS];
+    for (int i = 0; i < CONCURRENT_READERS; i++) {
+        args[i] = (struct readerArgs){ t, &done, true };
+        pthread_create(&tids[i], NULL, check, &args[i]);
+    }
+    bool ok = true;
+    for (int i = 0; i < CONCURRENT_KEYS; i++) {
+        if (!deleting) {
+            ConcurrentBSTInsert(t, i);
+        } else if (i % 2 == 0 && !ConcurrentBSTDelete(t, i)) {
+            ok = false;
+        }
+    }
+    atomic_store(&done, true);
+    for (int i = 0; i < CONCURRENT_READERS; i++) {
+        pthread_join(tids[i], NULL);
+        if (!args[i].ok) ok = false;
+    }
+    return ok;
+}
+
+// Tests for ConcurrentBST
+static void test_concurrentBST(void) {
+    print_header("ConcurrentBST Tests");
+
+    ConcurrentBST t = ConcurrentBSTNew();
+    run_test("Empty tree", ConcurrentBSTSize(t) == 0
+             && !ConcurrentBSTContains(t, 1)
+             && !ConcurrentBSTDelete(t, 1));
+
+    // Same inserts and deletes as an AVL tree give the same shape
+    int n = 3000;
+    struct node *root = NULL;
+    bool same = true;
+    for (int i = 0; i < n; i++) {
+        int v = (i * 7919) % 1000;
+        ConcurrentBSTInsert(t, v);
+        root = avlInsert(root, v);
+    }
+    for (int i = 0; i < n; i += 3) {
+        int v = (i * 7919) % 1000;
+        if (!ConcurrentBSTDelete(t, v)) same = false;
+        root = avlDelete(root, v);
+    }
+    for (int v = -1; v <= 1000; v++) {
+        if (ConcurrentBSTNodeLevel(t, v) != bstNodeLevel(root, v)
+            || ConcurrentBSTCountGreater(t, v) != bstCountGreater(root, v))
+            same = false;
+    }
+    run_test("Matches AVL (single thread)",
+             same && ConcurrentBSTSize(t) == bstNumNodes(root));
+    freeBST(root);
+    ConcurrentBSTFree(t);
+
+    t = ConcurrentBSTNew();
+    run_test("Readers during inserts", runWithReaders(t, checkGrowing, false));
+    run_test("Readers during deletes", runWithReaders(t, checkOddsKept, true)
+             && ConcurrentBSTSize(t) == CONCURRENT_KEYS / 2);
+    ConcurrentBSTFree(t);
+}
+
 // -----------------------------------------------------------------------------
 // Run All Tests
 // -----------------------------------------------------------------------------
@@ -448,6 +769,14 @@ static void run_all_tests(void) {
     test_bstHeight();
     test_bstNodeLevel();
     test_bstCountGreater();
+    test_avlInsert();
+    test_avlDelete();
+    test_orderStatistics();
+    test_eytzinger();
+    test_bstArena();
+    test_deepTreesAndIterator();
+    test_bulkLoad();
+    test_concurrentBST();
 }
 
 // -----------------------------------------------------------------------------
@@ -0,0 +1,327 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "BST.h"
+#include "BSTInternal.h"
+#include "ConcurrentBST.h"
+
+// Readers load the current root and walk it with the functions in BST.c.
+// Published nodes are never written again, so a reader always sees a
+// consistent tree, just possibly an old one.
+//
+// A writer copies every node on the path it changes (and any node a
+// rotation touches), links the copies together and publishes the new root
+// with a single store. The nodes it replaced are retired, not freed,
+// because readers may still be walking them.
+//
+// Epoch-based reclamation decides when retired nodes can go. A reader
+// claims a slot holding the current epoch for the length of one query.
+// Each write retires its nodes under the current epoch and then advances
+// it. Nodes retired in epoch e are freed once no slot holds an epoch <= e:
+// any reader that claimed a slot later loads a root published after they
+// were unlinked.
+
+#define CACHE_LINE 64
+#define READER_SLOTS 128
+#define RECLAIM_BATCH 256
+
+// A reader slot: 0 if free, else the epoch its reader entered in
+struct slot {
+    alignas(CACHE_LINE) atomic_uint_least64_t epoch;
+};
+
+struct retired {
+    struct node *node;
+    uint64_t epoch;
+};
+
+struct concurrentBST {
+    alignas(CACHE_LINE) _Atomic(struct node *) root;
+    alignas(CACHE_LINE) atomic_uint_least64_t epoch;
+    struct slot slots[READER_SLOTS];
+
+    // Writer state, protected by lock
+    alignas(CACHE_LINE) pthread_mutex_t lock;
+    struct node **fresh;        // nodes created by the current write
+    int numFresh;
+    int maxFresh;
+    struct retired *retired;    // oldest first
+    int numRetired;
+    int maxRetired;
+};
+
+// The slot each thread tries first, spreading threads over the slots
+static _Thread_local int slotHint = -1;
+static atomic_int nextHint = 0;
+
+static void outOfMemory(void) {
+    fprintf(stderr, "Memory allocation failed\n");
+    exit(1);
+}
+
+// -----------------------------------------------------------------------------
+// Readers
+// -----------------------------------------------------------------------------
+
+// Claims a reader slot for the current epoch and returns its index
+static int enter(ConcurrentBST t) {
+    if (slotHint < 0) {
+        slotHint = atomic_fetch_add(&nextHint, 1) % READER_SLOTS;
+    }
+    for (int i = slotHint; ; i = (i + 1) % READER_SLOTS) {
+        uint64_t unused = 0;
+        uint64_t epoch = atomic_load(&t->epoch);
+        if (atomic_compare_exchange_strong(&t->slots[i].epoch, &unused,
+                                           epoch)) {
+            slotHint = i;
+            return i;
+        }
+    }
+}
+
+static void leave(ConcurrentBST t, int slot) {
+    atomic_store_explicit(&t->slots[slot].epoch, 0, memory_order_release);
+}
+
+bool ConcurrentBSTContains(ConcurrentBST t, int key) {
+    return ConcurrentBSTNodeLevel(t, key) >= 0;
+}
+
+int ConcurrentBSTNodeLevel(ConcurrentBST t, int key) {
+    int slot = enter(t);
+    int level = bstNodeLevel(atomic_load(&t->root), key);
+    leave(t, slot);
+    return level;
+}
+
+int ConcurrentBSTCountGreater(ConcurrentBST t, int val) {
+    int slot = enter(t);
+    int count = bstCountGreater(atomic_load(&t->root), val);
+    leave(t, slot);
+    return count;
+}
+
+int ConcurrentBSTSize(ConcurrentBST t) {
+    int slot = enter(t);
+    int size = bstNumNodes(atomic_load(&t->root));
+    leave(t, slot);
+    return size;
+}
+
+// -----------------------------------------------------------------------------
+// Reclamation
+// -----------------------------------------------------------------------------
+
+static void retire(ConcurrentBST t, struct node *n) {
+    if (t->numRetired == t->maxRetired) {
+        t->maxRetired *= 2;
+        t->retired = realloc(t->retired,
+                             t->maxRetired * sizeof(struct retired));
+        if (t->retired == NULL) outOfMemory();
+    }
+    // Tagged with the epoch that the write will end by advancing
+    t->retired[t->numRetired++] = (struct retired){
+        n, atomic_load(&t->epoch)
+    };
+}
+
+// Frees every retired node that no reader can still reach
+static void reclaim(ConcurrentBST t) {
+    uint64_t oldest = atomic_load(&t->epoch);
+    for (int i = 0; i < READER_SLOTS; i++) {
+        uint64_t e = atomic_load(&t->slots[i].epoch);
+        if (e != 0 && e < oldest) oldest = e;
+    }
+    int kept = 0;
+    for (int i = 0; i < t->numRetired; i++) {
+        if (t->retired[i].epoch < oldest) {
+            free(t->retired[i].node);
+        } else {
+            t->retired[kept++] = t->retired[i];
+        }
+    }
+    t->numRetired = kept;
+}
+
+// -----------------------------------------------------------------------------
+// Path Copying
+// -----------------------------------------------------------------------------
+
+static struct node *track(ConcurrentBST t, struct node *n) {
+    if (t->numFresh == t->maxFresh) {
+        t->maxFresh *= 2;
+        t->fresh = realloc(t->fresh, t->maxFresh * sizeof(struct node *));
+        if (t->fresh == NULL) outOfMemory();
+    }
+    t->fresh[t->numFresh++] = n;
+    return n;
+}
+
+static struct node *newLeaf(ConcurrentBST t, int value) {
+    struct node *n = malloc(sizeof(struct node));
+    if (n == NULL) outOfMemory();
+    *n = (struct node){ value, 0, 1, NULL, NULL };
+    return track(t, n);
+}
+
+// Returns a copy of n that this write may modify, retiring n
+static struct node *copy(ConcurrentBST t, struct node *n) {
+    struct node *c = malloc(sizeof(struct node));
+    if (c == NULL) outOfMemory();
+    *c = *n;
+    retire(t, n);
+    return track(t, c);
+}
+
+// Returns n if this write created it, else a copy of n
+static struct node *own(ConcurrentBST t, struct node *n) {
+    for (int i = 0; i < t->numFresh; i++) {
+        if (t->fresh[i] == n) return n;
+    }
+    return copy(t, n);
+}
+
+// The rotations and rebalance mirror those in BST.c, but only ever modify
+// nodes owned by the current write
+
+static struct node *rotateRight(ConcurrentBST t, struct node *n) {
+    struct node *l = own(t, n->left);
+    n->left = l->right;
+    l->right = n;
+    update(n);
+    update(l);
+    return l;
+}
+
+static struct node *rotateLeft(ConcurrentBST t, struct node *n) {
+    struct node *r = own(t, n->right);
+    n->right = r->left;
+    r->left = n;
+    update(n);
+    update(r);
+    return r;
+}
+
+static struct node *rebalance(ConcurrentBST t, struct node *n) {
+    update(n);
+    int balance = height(n->left) - height(n->right);
+    if (balance > 1) {
+        if (height(n->left->left) < height(n->left->right))
+            n->left = rotateLeft(t, own(t, n->left));
+        return rotateRight(t, n);
+    }
+    if (balance < -1) {
+        if (height(n->right->right) < height(n->right->left))
+            n->right = rotateRight(t, own(t, n->right));
+        return rotateLeft(t, n);
+    }
+    return n;
+}
+
+static struct node *insert(ConcurrentBST t, struct node *n, int value) {
+    if (n == NULL)
+        return newLeaf(t, value);
+    struct node *c = copy(t, n);
+    if (value < c->value)
+        c->left = insert(t, c->left, value);
+    else
+        c->right = insert(t, c->right, value);
+    return rebalance(t, c);
+}
+
+// Returns the new root of the subtree, or n itself if value is not in it
+static struct node *delete(ConcurrentBST t, struct node *n, int value,
+                           bool *found) {
+    if (n == NULL)
+        return NULL;
+    struct node *c;
+    if (value < n->value) {
+        struct node *l = delete(t, n->left, value, found);
+        if (!*found) return n;
+        c = copy(t, n);
+        c->left = l;
+    } else if (value > n->value) {
+        struct node *r = delete(t, n->right, value, found);
+        if (!*found) return n;
+        c = copy(t, n);
+        c->right = r;
+    } else if (n->left == NULL || n->right == NULL) {
+        *found = true;
+        retire(t, n);
+        return (n->left != NULL) ? n->left : n->right;
+    } else {
+        // Two children: the copy takes the in-order successor's value,
+        // and the successor is deleted from the right subtree
+        struct node *succ = n->right;
+        while (succ->left != NULL)
+            succ = succ->left;
+        c = copy(t, n);
+        c->value = succ->value;
+        c->right = delete(t, n->right, succ->value, found);
+    }
+    return rebalance(t, c);
+}
+
+// Makes newRoot visible to readers and ends the write
+static void publish(ConcurrentBST t, struct node *newRoot) {
+    atomic_store(&t->root, newRoot);
+    atomic_fetch_add(&t->epoch, 1);
+    t->numFresh = 0;
+    if (t->numRetired >= RECLAIM_BATCH) reclaim(t);
+}
+
+// -----------------------------------------------------------------------------
+// Writers
+// -----------------------------------------------------------------------------
+
+ConcurrentBST ConcurrentBSTNew(void) {
+    ConcurrentBST t = aligned_alloc(CACHE_LINE, sizeof(struct concurrentBST));
+    if (t == NULL) outOfMemory();
+    atomic_init(&t->root, NULL);
+    atomic_init(&t->epoch, 1);
+    for (int i = 0; i < READER_SLOTS; i++) {
+        atomic_init(&t->slots[i].epoch, 0);
+    }
+    pthread_mutex_init(&t->lock, NULL);
+    t->maxFresh = 64;
+    t->numFresh = 0;
+    t->fresh = malloc(t->maxFresh * sizeof(struct node *));
+    t->maxRetired = RECLAIM_BATCH * 2;
+    t->numRetired = 0;
+    t->retired = malloc(t->maxRetired * sizeof(struct retired));
+    if (t->fresh == NULL || t->retired == NULL) outOfMemory();
+    return t;
+}
+
+void ConcurrentBSTFree(ConcurrentBST t) {
+    for (int i = 0; i < t->numRetired; i++) {
+        free(t->retired[i].node);
+    }
+    freeBST(atomic_load(&t->root));
+    pthread_mutex_destroy(&t->lock);
+    free(t->fresh);
+    free(t->retired);
+    free(t);
+}
+
+void ConcurrentBSTInsert(ConcurrentBST t, int value) {
+    pthread_mutex_lock(&t->lock);
+    struct node *root = atomic_load_explicit(&t->root, memory_order_relaxed);
+    publish(t, insert(t, root, value));
+    pthread_mutex_unlock(&t->lock);
+}
+
+bool ConcurrentBSTDelete(ConcurrentBST t, int value) {
+    pthread_mutex_lock(&t->lock);
+    struct node *root = atomic_load_explicit(&t->root, memory_order_relaxed);
+    bool found = false;
+    struct node *newRoot = delete(t, root, value, &found);
+    if (found) publish(t, newRoot);
+    pthread_mutex_unlock(&t->lock);
+    return found;
+}
@@ -0,0 +1,38 @@
+#ifndef CONCURRENT_BST_H
+#define CONCURRENT_BST_H
+#include <stdbool.h>
+
+// An AVL tree that any number of threads can query while writers insert
+// and delete. Readers take no locks: they run the ordinary BST queries on
+// an immutable snapshot of the tree. Writers are serialised and never
+// modify a node that a reader might see; they copy the path they change
+// and publish a new root.
+typedef struct concurrentBST *ConcurrentBST;
+
+// Creates a new empty tree
+ConcurrentBST ConcurrentBSTNew(void);
+
+// Frees the tree
+// No other thread may be using it
+void ConcurrentBSTFree(ConcurrentBST t);
+
+// Inserts a value, keeping the tree balanced
+void ConcurrentBSTInsert(ConcurrentBST t, int value);
+
+// Deletes one instance of value
+// Returns false if the value was not in the tree
+bool ConcurrentBSTDelete(ConcurrentBST t, int value);
+
+// Returns whether key is in the tree
+bool ConcurrentBSTContains(ConcurrentBST t, int key);
+
+// Returns the level of the node containing key (root is 0), or -1
+int ConcurrentBSTNodeLevel(ConcurrentBST t, int key);
+
+// Counts the number of values greater than val
+int ConcurrentBSTCountGreater(ConcurrentBST t, int val);
+
+// Returns the number of values in the tree
+int ConcurrentBSTSize(ConcurrentBST t);
+
+#endif // CONCURRENT_BST_H
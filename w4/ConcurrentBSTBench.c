@@ -0,0 +1,141 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "BST.h"
+#include "ConcurrentBST.h"
+
+// -----------------------------------------------------------------------------
+// Read-mostly benchmark: ConcurrentBST against an AVL tree behind a
+// readers-writer lock.
+//
+// Usage: ./ConcurrentBSTBench [totalOps] [writePercent] [maxThreads]
+// Both trees start with KEYS values. The threads split totalOps operations;
+// writePercent of them (1 by default) insert or delete a random key and
+// the rest call NodeLevel or CountGreater. The thread count doubles from
+// 1 up to maxThreads (64 by default). Throughput is total operations per
+// second.
+// -----------------------------------------------------------------------------
+
+#define KEYS 1000000
+
+struct lockedTree {
+    pthread_rwlock_t lock;
+    struct node *root;
+};
+
+struct args {
+    void *tree;
+    long ops;
+    int writePercent;
+    unsigned seed;
+    long checksum;
+};
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned nextRandom(unsigned *state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+static void *runConcurrent(void *arg) {
+    struct args *a = arg;
+    ConcurrentBST t = a->tree;
+    for (long i = 0; i < a->ops; i++) {
+        unsigned r = nextRandom(&a->seed);
+        int key = (int)((r >> 8) % (2 * KEYS));
+        if ((int)(r % 100) < a->writePercent) {
+            if (r & 128) ConcurrentBSTInsert(t, key);
+            else ConcurrentBSTDelete(t, key);
+        } else if (r & 128) {
+            a->checksum += ConcurrentBSTNodeLevel(t, key);
+        } else {
+            a->checksum += ConcurrentBSTCountGreater(t, key);
+        }
+    }
+    return NULL;
+}
+
+static void *runLocked(void *arg) {
+    struct args *a = arg;
+    struct lockedTree *lt = a->tree;
+    for (long i = 0; i < a->ops; i++) {
+        unsigned r = nextRandom(&a->seed);
+        int key = (int)((r >> 8) % (2 * KEYS));
+        if ((int)(r % 100) < a->writePercent) {
+            pthread_rwlock_wrlock(&lt->lock);
+            if (r & 128) lt->root = avlInsert(lt->root, key);
+            else lt->root = avlDelete(lt->root, key);
+            pthread_rwlock_unlock(&lt->lock);
+        } else {
+            pthread_rwlock_rdlock(&lt->lock);
+            if (r & 128) a->checksum += bstNodeLevel(lt->root, key);
+            else a->checksum += bstCountGreater(lt->root, key);
+            pthread_rwlock_unlock(&lt->lock);
+        }
+    }
+    return NULL;
+}
+
+// Runs fn on threads threads and returns millions of operations per second
+static double run(void *(*fn)(void *), void *tree, int threads, long ops,
+                  int writePercent) {
+    pthread_t *tids = malloc(threads * sizeof *tids);
+    struct args *args = malloc(threads * sizeof *args);
+    if (tids == NULL || args == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    double start = now();
+    for (int i = 0; i < threads; i++) {
+        args[i] = (struct args){ tree, ops, writePercent, 2521u + i, 0 };
+        pthread_create(&tids[i], NULL, fn, &args[i]);
+    }
+    for (int i = 0; i < threads; i++) {
+        pthread_join(tids[i], NULL);
+    }
+    double secs = now() - start;
+    free(args);
+    free(tids);
+    return threads * ops / secs / 1e6;
+}
+
+int main(int argc, char *argv[]) {
+    long ops = (argc > 1) ? atol(argv[1]) : 4000000;
+    int writePercent = (argc > 2) ? atoi(argv[2]) : 1;
+    int maxThreads = (argc > 3) ? atoi(argv[3]) : 64;
+
+    printf("%ld operations in total, %d%% writes, %d keys\n",
+           ops, writePercent, KEYS);
+    printf("threads  lock-free readers Mops/s  rwlock Mops/s\n");
+    for (int t = 1; t <= maxThreads; t *= 2) {
+        ConcurrentBST ct = ConcurrentBSTNew();
+        struct lockedTree locked = { .root = NULL };
+        pthread_rwlock_init(&locked.lock, NULL);
+        for (int i = 0; i < KEYS; i++) {
+            ConcurrentBSTInsert(ct, 2 * i);
+            locked.root = avlInsert(locked.root, 2 * i);
+        }
+
+        double concurrentRate = run(runConcurrent, ct, t, ops / t,
+                                    writePercent);
+        double lockedRate = run(runLocked, &locked, t, ops / t,
+                                writePercent);
+        printf("%7d  %24.2f  %13.2f\n", t, concurrentRate, lockedRate);
+
+        pthread_rwlock_destroy(&locked.lock);
+        freeBST(locked.root);
+        ConcurrentBSTFree(ct);
+    }
+    return 0;
+}
@@ -0,0 +1,149 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+
+#include "Deque.h"
+
+// Chase-Lev deque with the C11 memory orderings from Le, Pop, Cohen and
+// Zappa Nardelli, "Correct and Efficient Work-Stealing for Weak Memory
+// Models" (PPoPP 2013). top only ever increases, and is advanced by a CAS
+// from thieves (and by the owner when it takes the last item); bottom is
+// only written by the owner.
+
+#define CACHE_LINE 64
+#define INITIAL_CAPACITY 64
+
+// A circular buffer. When it fills, the owner copies the live items into
+// one twice the size; the old buffer is kept until the deque is freed
+// because a thief may still be reading from it.
+struct buffer {
+	int64_t capacity;              // always a power of two
+	struct buffer *retired;        // older buffer this one replaced
+	_Atomic(void *) items[];
+};
+
+struct deque {
+	alignas(CACHE_LINE) atomic_int_least64_t top;
+	alignas(CACHE_LINE) atomic_int_least64_t bottom;
+	_Atomic(struct buffer *) buffer;
+};
+
+static struct buffer *newBuffer(int64_t capacity) {
+	struct buffer *b = malloc(sizeof(struct buffer)
+	                          + capacity * sizeof(_Atomic(void *)));
+	if (b == NULL) {
+		fprintf(stderr, "Memory allocation failed\n");
+		exit(1);
+	}
+	b->capacity = capacity;
+	b->retired = NULL;
+	return b;
+}
+
+static inline void *load(struct buffer *b, int64_t i) {
+	return atomic_load_explicit(&b->items[i & (b->capacity - 1)],
+	                            memory_order_relaxed);
+}
+
+static inline void store(struct buffer *b, int64_t i, void *item) {
+	atomic_store_explicit(&b->items[i & (b->capacity - 1)], item,
+	                      memory_order_relaxed);
+}
+
+// Replaces the buffer with one twice the size holding items top..bottom-1
+static struct buffer *grow(Deque d, struct buffer *old,
+                           int64_t top, int64_t bottom) {
+	struct buffer *b = newBuffer(old->capacity * 2);
+	for (int64_t i = top; i < bottom; i++) {
+		store(b, i, load(old, i));
+	}
+	b->retired = old;
+	atomic_store_explicit(&d->buffer, b, memory_order_release);
+	return b;
+}
+
+Deque DequeNew(void) {
+	Deque d = aligned_alloc(CACHE_LINE, sizeof(struct deque));
+	if (d == NULL) {
+		fprintf(stderr, "Memory allocation failed\n");
+		exit(1);
+	}
+	atomic_init(&d->top, 0);
+	atomic_init(&d->bottom, 0);
+	atomic_init(&d->buffer, newBuffer(INITIAL_CAPACITY));
+	return d;
+}
+
+void DequePush(Deque d, void *item) {
+	int64_t b = atomic_load_explicit(&d->bottom, memory_order_relaxed);
+	int64_t t = atomic_load_explicit(&d->top, memory_order_acquire);
+	struct buffer *buf = atomic_load_explicit(&d->buffer,
+	                                          memory_order_relaxed);
+	if (b - t > buf->capacity - 1) {
+		buf = grow(d, buf, t, b);
+	}
+	store(buf, b, item);
+	// The paper uses a release fence and a relaxed store here; a release
+	// store is equivalent for publishing the item, and is visible to
+	// ThreadSanitizer
+	atomic_store_explicit(&d->bottom, b + 1, memory_order_release);
+}
+
+void *DequePop(Deque d) {
+	int64_t b = atomic_load_explicit(&d->bottom, memory_order_relaxed) - 1;
+	struct buffer *buf = atomic_load_explicit(&d->buffer,
+	                                          memory_order_relaxed);
+	atomic_store_explicit(&d->bottom, b, memory_order_relaxed);
+	atomic_thread_fence(memory_order_seq_cst);
+	int64_t t = atomic_load_explicit(&d->top, memory_order_relaxed);
+
+	if (t > b) {
+		// Empty
+		atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+		return NULL;
+	}
+	void *item = load(buf, b);
+	if (t == b) {
+		// Last item: race the thieves for it
+		if (!atomic_compare_exchange_strong_explicit(&d->top, &t, t + 1,
+		        memory_order_seq_cst, memory_order_relaxed)) {
+			item = NULL;
+		}
+		atomic_store_explicit(&d->bottom, b + 1, memory_order_relaxed);
+	}
+	return item;
+}
+
+void *DequeSteal(Deque d) {
+	int64_t t = atomic_load_explicit(&d->top, memory_order_acquire);
+	atomic_thread_fence(memory_order_seq_cst);
+	int64_t b = atomic_load_explicit(&d->bottom, memory_order_acquire);
+	if (t >= b) return NULL;
+
+	struct buffer *buf = atomic_load_explicit(&d->buffer,
+	                                          memory_order_acquire);
+	void *item = load(buf, t);
+	if (!atomic_compare_exchange_strong_explicit(&d->top, &t, t + 1,
+	        memory_order_seq_cst, memory_order_relaxed)) {
+		return NULL;
+	}
+	return item;
+}
+
+int DequeSize(Deque d) {
+	int64_t b = atomic_load_explicit(&d->bottom, memory_order_relaxed);
+	int64_t t = atomic_load_explicit(&d->top, memory_order_relaxed);
+	return (b > t) ? (int)(b - t) : 0;
+}
+
+void DequeFree(Deque d) {
+	struct buffer *b = atomic_load(&d->buffer);
+	while (b != NULL) {
+		struct buffer *retired = b->retired;
+		free(b);
+		b = retired;
+	}
+	free(d);
+}
@@ -0,0 +1,31 @@
+#ifndef DEQUE_H
+#define DEQUE_H
+
+// A Chase-Lev work-stealing deque of non-NULL pointers. One owner thread
+// pushes and pops at the bottom; any other thread may steal from the top.
+typedef struct deque *Deque;
+
+// Creates a new empty deque
+Deque DequeNew(void);
+
+// Pushes an item onto the bottom of the deque (owner only)
+// The item must not be NULL
+void DequePush(Deque d, void *item);
+
+// Pops an item from the bottom of the deque (owner only)
+// Returns NULL if the deque is empty
+void *DequePop(Deque d);
+
+// Steals an item from the top of the deque (any thread)
+// Returns NULL if the deque is empty or another thread won the item
+void *DequeSteal(Deque d);
+
+// Returns the number of items in the deque
+// Only a snapshot while other threads are running
+int DequeSize(Deque d);
+
+// Frees the deque
+// No other thread may be using it
+void DequeFree(Deque d);
+
+#endif // DEQUE_H
@@ -0,0 +1,188 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "Deque.h"
+#include "ThreadPool.h"
+
+// ANSI colour codes
+#define RESET   "\033[0m"
+#define GREEN   "\033[32m"
+#define RED     "\033[31m"
+
+#define ITEMS 100000
+#define THIEVES 3
+
+// -----------------------------------------------------------------------------
+// Test Suite Helper Functions
+// -----------------------------------------------------------------------------
+static void run_test(const char *test_name, bool condition) {
+    if (condition) {
+        printf("%sTest %s: PASSED%s\n", GREEN, test_name, RESET);
+    } else {
+        printf("%sTest %s: FAILED%s\n", RED, test_name, RESET);
+    }
+}
+
+static void print_test_suite_header(const char *suite_name) {
+    printf("\nTest Suite: %s\n", suite_name);
+    printf("-----------------------\n");
+}
+
+// -----------------------------------------------------------------------------
+// Test Cases for Deque
+// -----------------------------------------------------------------------------
+
+// Test 1: Owner and Thief Ends
+// The owner pops in LIFO order and a thief steals in FIFO order.
+static void test_deque_ends(void) {
+    print_test_suite_header("Deque Ends");
+    Deque d = DequeNew();
+    static int values[200];
+    bool condition = DequePop(d) == NULL && DequeSteal(d) == NULL;
+    for (int i = 0; i < 200; i++) {
+        values[i] = i;
+        DequePush(d, &values[i]);
+    }
+    condition = condition && DequeSize(d) == 200;
+    condition = condition && *(int *)DequeSteal(d) == 0
+                          && *(int *)DequeSteal(d) == 1;
+    condition = condition && *(int *)DequePop(d) == 199
+                          && *(int *)DequePop(d) == 198;
+    int left = 0;
+    while (DequePop(d) != NULL) left++;
+    condition = condition && left == 196 && DequeSize(d) == 0;
+    run_test("LIFO pop, FIFO steal, growth past initial capacity", condition);
+    DequeFree(d);
+}
+
+struct thief {
+    Deque d;
+    atomic_bool *finished;
+    long long sum;
+};
+
+static void *steal(void *arg) {
+    struct thief *t = arg;
+    while (!atomic_load(t->finished) || DequeSize(t->d) > 0) {
+        int *item = DequeSteal(t->d);
+        if (item != NULL) {
+            t->sum += *item;
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+// Test 2: Concurrent Steals
+// The owner pushes and pops while thieves steal; every item is taken once.
+static void test_deque_threads(void) {
+    print_test_suite_header("Deque Across Threads");
+    Deque d = DequeNew();
+    int *values = malloc(ITEMS * sizeof(int));
+    atomic_bool finished = false;
+    struct thief thieves[THIEVES];
+    pthread_t threads[THIEVES];
+    for (int i = 0; i < THIEVES; i++) {
+        thieves[i] = (struct thief){ d, &finished, 0 };
+        pthread_create(&threads[i], NULL, steal, &thieves[i]);
+    }
+
+    long long expected = 0, taken = 0;
+    for (int i = 0; i < ITEMS; i++) {
+        values[i] = i;
+        expected += i;
+        DequePush(d, &values[i]);
+        if (i % 2 == 0) {
+            int *item = DequePop(d);
+            if (item != NULL) taken += *item;
+        }
+    }
+    int *item;
+    while ((item = DequePop(d)) != NULL) taken += *item;
+    atomic_store(&finished, true);
+    for (int i = 0; i < THIEVES; i++) {
+        pthread_join(threads[i], NULL);
+        taken += thieves[i].sum;
+    }
+    run_test("No items lost or taken twice", taken == expected);
+    free(values);
+    DequeFree(d);
+}
+
+// -----------------------------------------------------------------------------
+// Test Cases for ThreadPool
+// -----------------------------------------------------------------------------
+
+struct fibArgs {
+    ThreadPool pool;
+    int n;
+    long result;
+};
+
+static void fib(void *arg) {
+    struct fibArgs *a = arg;
+    if (a->n < 2) {
+        a->result = a->n;
+        return;
+    }
+    struct fibArgs left = { a->pool, a->n - 1, 0 };
+    struct fibArgs right = { a->pool, a->n - 2, 0 };
+    struct task t;
+    ThreadPoolSpawn(a->pool, &t, fib, &left);
+    fib(&right);
+    ThreadPoolJoin(a->pool, &t);
+    a->result = left.result + right.result;
+}
+
+// Test 3: Recursive Fork-Join
+static void test_pool_fib(void) {
+    print_test_suite_header("ThreadPool Fork-Join");
+    ThreadPool pool = ThreadPoolNew(4);
+    struct fibArgs args = { pool, 20, 0 };
+    ThreadPoolRun(pool, fib, &args);
+    bool condition = args.result == 6765;
+
+    // The pool can be reused for another run
+    args.n = 15;
+    ThreadPoolRun(pool, fib, &args);
+    condition = condition && args.result == 610;
+    run_test("fib(20) and fib(15) on a 4-worker pool", condition);
+    ThreadPoolFree(pool);
+}
+
+// Test 4: Spawn Outside the Pool
+// Without a Run, spawned tasks simply run immediately.
+static void test_pool_outside(void) {
+    print_test_suite_header("ThreadPool Outside a Run");
+    ThreadPool pool = ThreadPoolNew(2);
+    struct fibArgs args = { pool, 10, 0 };
+    struct task t;
+    ThreadPoolSpawn(pool, &t, fib, &args);
+    ThreadPoolJoin(pool, &t);
+    run_test("fib(10) spawned from outside the pool", args.result == 55);
+    ThreadPoolFree(pool);
+}
+
+// -----------------------------------------------------------------------------
+// Run All Tests
+// -----------------------------------------------------------------------------
+static void run_tests(void) {
+    test_deque_ends();
+    test_deque_threads();
+    test_pool_fib();
+    test_pool_outside();
+}
+
+// -----------------------------------------------------------------------------
+// Main Function
+// -----------------------------------------------------------------------------
+int main(void) {
+    run_tests();
+    return 0;
+}
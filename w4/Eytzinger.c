@@ -0,0 +1,102 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "Eytzinger.h"
+
+#define CACHE_LINE 64
+
+// Sixteen ints fill a cache line, and node k's descendants four levels
+// down are nodes 16k..16k+15, so prefetching &keys[16k] fetches them all
+// while the current four levels are being compared.
+#define PREFETCH_STRIDE (CACHE_LINE / (int)sizeof(int))
+
+struct eytzinger {
+    int n;
+    int *keys;      // keys[1..n] in Eytzinger order; keys[0] is unused
+    int *rank;      // rank[k] = position of keys[k] in sorted order
+};
+
+static int compareInts(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+// Fills the subtree rooted at k by an in-order walk over sorted[i..],
+// returning the index of the next unused sorted value
+static int fill(Eytzinger e, int *sorted, int i, int k) {
+    if (k > e->n) return i;
+    i = fill(e, sorted, i, 2 * k);
+    e->keys[k] = sorted[i];
+    e->rank[k] = i;
+    return fill(e, sorted, i + 1, 2 * k + 1);
+}
+
+// Returns the slot of the first key satisfying !(key before target), where
+// before is <  (lower bound) or <= (upper bound); 0 if there is none.
+// The loop has no data-dependent branch, only the final shift does.
+static inline int search(Eytzinger e, int target, bool upper) {
+    int k = 1;
+    while (k <= e->n) {
+        __builtin_prefetch(e->keys + PREFETCH_STRIDE * k);
+        int key = e->keys[k];
+        k = 2 * k + (upper ? key <= target : key < target);
+    }
+    // k has walked past a leaf; the answer is the last node where we went
+    // left, found by dropping the trailing 1 bits and then one 0 bit
+    return k >> __builtin_ffs(~k);
+}
+
+Eytzinger EytzingerNew(int vals[], int n) {
+    Eytzinger e = malloc(sizeof(struct eytzinger));
+    int *sorted = malloc((n > 0 ? n : 1) * sizeof(int));
+    size_t bytes = ((n + 1) * sizeof(int) + CACHE_LINE - 1)
+                   / CACHE_LINE * CACHE_LINE;
+    if (e == NULL || sorted == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    e->n = n;
+    e->keys = aligned_alloc(CACHE_LINE, bytes);
+    e->rank = malloc((n + 1) * sizeof(int));
+    if (e->keys == NULL || e->rank == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    for (int i = 0; i < n; i++) sorted[i] = vals[i];
+    qsort(sorted, n, sizeof(int), compareInts);
+    fill(e, sorted, 0, 1);
+    free(sorted);
+    return e;
+}
+
+void EytzingerFree(Eytzinger e) {
+    free(e->keys);
+    free(e->rank);
+    free(e);
+}
+
+int EytzingerSize(Eytzinger e) {
+    return e->n;
+}
+
+bool EytzingerContains(Eytzinger e, int key) {
+    int k = search(e, key, false);
+    return k != 0 && e->keys[k] == key;
+}
+
+int EytzingerLevel(Eytzinger e, int key) {
+    int level = 0;
+    for (int k = 1; k <= e->n; level++) {
+        int value = e->keys[k];
+        if (value == key) return level;
+        k = 2 * k + (key > value);
+    }
+    return -1;
+}
+
+int EytzingerCountGreater(Eytzinger e, int val) {
+    int k = search(e, val, true);
+    if (k == 0) return 0;
+    return e->n - e->rank[k];
+}
@@ -0,0 +1,117 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ThreadPool.h"
+
+// -----------------------------------------------------------------------------
+// Scaling benchmark for ThreadPool.
+//
+// Usage: ./ForkJoinBench [fibN] [sumLength] [maxThreads]
+// Runs a recursive fib and a divide-and-conquer array sum on pools of
+// 1, 2, 4, ... maxThreads workers (the number of online CPUs by default)
+// and prints the speedup over one worker.
+// -----------------------------------------------------------------------------
+
+#define FIB_CUTOFF 20
+#define SUM_CUTOFF 8192
+
+struct fibArgs {
+    ThreadPool pool;
+    int n;
+    long result;
+};
+
+struct sumArgs {
+    ThreadPool pool;
+    const int *arr;
+    long n;
+    long long result;
+};
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static long fibSeq(int n) {
+    return (n < 2) ? n : fibSeq(n - 1) + fibSeq(n - 2);
+}
+
+static void fib(void *arg) {
+    struct fibArgs *a = arg;
+    if (a->n < FIB_CUTOFF) {
+        a->result = fibSeq(a->n);
+        return;
+    }
+    struct fibArgs left = { a->pool, a->n - 1, 0 };
+    struct fibArgs right = { a->pool, a->n - 2, 0 };
+    struct task t;
+    ThreadPoolSpawn(a->pool, &t, fib, &left);
+    fib(&right);
+    ThreadPoolJoin(a->pool, &t);
+    a->result = left.result + right.result;
+}
+
+static void sum(void *arg) {
+    struct sumArgs *a = arg;
+    if (a->n <= SUM_CUTOFF) {
+        long long total = 0;
+        for (long i = 0; i < a->n; i++) total += a->arr[i];
+        a->result = total;
+        return;
+    }
+    long half = a->n / 2;
+    struct sumArgs left = { a->pool, a->arr, half, 0 };
+    struct sumArgs right = { a->pool, a->arr + half, a->n - half, 0 };
+    struct task t;
+    ThreadPoolSpawn(a->pool, &t, sum, &left);
+    sum(&right);
+    ThreadPoolJoin(a->pool, &t);
+    a->result = left.result + right.result;
+}
+
+int main(int argc, char *argv[]) {
+    int fibN = (argc > 1) ? atoi(argv[1]) : 36;
+    long sumLength = (argc > 2) ? atol(argv[2]) : 1L << 26;
+    int maxThreads = (argc > 3) ? atoi(argv[3])
+                                : (int)sysconf(_SC_NPROCESSORS_ONLN);
+
+    int *arr = malloc(sumLength * sizeof(int));
+    if (arr == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return 1;
+    }
+    for (long i = 0; i < sumLength; i++) arr[i] = (int)(i % 1000);
+
+    printf("fib(%d), sum of %ld ints\n", fibN, sumLength);
+    printf("threads  fib secs  speedup  sum secs  speedup\n");
+    double fibBase = 0, sumBase = 0;
+    for (int t = 1; t <= maxThreads; t *= 2) {
+        ThreadPool pool = ThreadPoolNew(t);
+
+        struct fibArgs f = { pool, fibN, 0 };
+        double start = now();
+        ThreadPoolRun(pool, fib, &f);
+        double fibSecs = now() - start;
+
+        struct sumArgs s = { pool, arr, sumLength, 0 };
+        start = now();
+        ThreadPoolRun(pool, sum, &s);
+        double sumSecs = now() - start;
+
+        if (t == 1) {
+            fibBase = fibSecs;
+            sumBase = sumSecs;
+        }
+        printf("%7d  %8.3f  %7.2f  %8.3f  %7.2f  (fib=%ld sum=%lld)\n",
+               t, fibSecs, fibBase / fibSecs, sumSecs, sumBase / sumSecs,
+               f.result, s.result);
+        ThreadPoolFree(pool);
+    }
+    free(arr);
+    return 0;
+}
@@ -0,0 +1,170 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include "LockFreeStack.h"
+
+// Treiber stack. Nodes live in chunks that are never freed until the
+// stack is, and are named by a 32-bit index (0 means NULL). The top of the
+// stack, and the free list of spare nodes, are each a 64-bit word holding
+// the index in the low half and a tag in the high half. Every successful
+// CAS bumps the tag, so a thread that read top, was preempted while the
+// node was popped and pushed again, and then tries its CAS, fails instead
+// of corrupting the stack (the ABA problem). Because nodes are never
+// handed back to malloc, reading a stale node's next field is harmless.
+
+#define CACHE_LINE 64
+#define CHUNK_BITS 12
+#define CHUNK_SIZE (1 << CHUNK_BITS)
+#define MAX_CHUNKS (1 << 14)
+
+// Definition of the node structure
+struct node {
+    int data;
+    atomic_uint_least32_t next;
+};
+
+// Definition of the stack structure
+struct lockFreeStack {
+    alignas(CACHE_LINE) atomic_uint_least64_t top;
+    alignas(CACHE_LINE) atomic_uint_least64_t free;
+    alignas(CACHE_LINE) atomic_uint_least32_t nextFresh;
+    atomic_int size;
+    _Atomic(struct node *) chunks[MAX_CHUNKS];
+};
+
+typedef struct node* Node;
+
+static inline Node nodeAt(LockFreeStack s, uint32_t index) {
+    Node chunk = atomic_load_explicit(&s->chunks[index >> CHUNK_BITS],
+                                      memory_order_acquire);
+    return &chunk[index & (CHUNK_SIZE - 1)];
+}
+
+static inline uint64_t tagged(uint64_t old, uint32_t index) {
+    return (((old >> 32) + 1) << 32) | index;
+}
+
+// Pushes the node with the given index onto list
+static void pushIndex(LockFreeStack s, atomic_uint_least64_t *list,
+                      uint32_t index) {
+    Node n = nodeAt(s, index);
+    uint64_t old = atomic_load_explicit(list, memory_order_relaxed);
+    do {
+        atomic_store_explicit(&n->next, (uint32_t)old, memory_order_relaxed);
+    } while (!atomic_compare_exchange_weak_explicit(list, &old,
+                 tagged(old, index),
+                 memory_order_release, memory_order_relaxed));
+}
+
+// Pops a node off list and returns its index, or 0 if list is empty
+static uint32_t popIndex(LockFreeStack s, atomic_uint_least64_t *list) {
+    uint64_t old = atomic_load_explicit(list, memory_order_acquire);
+    for (;;) {
+        uint32_t index = (uint32_t)old;
+        if (index == 0) return 0;
+        uint32_t next = atomic_load_explicit(&nodeAt(s, index)->next,
+                                             memory_order_relaxed);
+        if (atomic_compare_exchange_weak_explicit(list, &old,
+                tagged(old, next),
+                memory_order_acquire, memory_order_acquire)) {
+            return index;
+        }
+    }
+}
+
+// Takes a spare node if there is one, otherwise the next fresh node,
+// installing a new chunk when the fresh node starts one
+static uint32_t allocIndex(LockFreeStack s) {
+    uint32_t index = popIndex(s, &s->free);
+    if (index != 0) return index;
+
+    index = atomic_fetch_add_explicit(&s->nextFresh, 1, memory_order_relaxed);
+    uint32_t c = index >> CHUNK_BITS;
+    if (c >= MAX_CHUNKS) {
+        fprintf(stderr, "Stack is full\n");
+        exit(1);
+    }
+    if (atomic_load_explicit(&s->chunks[c], memory_order_acquire) == NULL) {
+        Node chunk = calloc(CHUNK_SIZE, sizeof(struct node));
+        if (chunk == NULL) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(1);
+        }
+        Node expected = NULL;
+        if (!atomic_compare_exchange_strong_explicit(&s->chunks[c],
+                &expected, chunk,
+                memory_order_acq_rel, memory_order_acquire)) {
+            free(chunk);
+        }
+    }
+    return index;
+}
+
+// Creates a new empty stack
+LockFreeStack LockFreeStackNew(void) {
+    LockFreeStack s = aligned_alloc(CACHE_LINE, sizeof(struct lockFreeStack));
+    if (s == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    atomic_init(&s->top, 0);
+    atomic_init(&s->free, 0);
+    atomic_init(&s->nextFresh, 1);
+    atomic_init(&s->size, 0);
+    for (int i = 0; i < MAX_CHUNKS; i++) {
+        atomic_init(&s->chunks[i], NULL);
+    }
+    return s;
+}
+
+// Pushes an item onto the stack
+void LockFreeStackPush(LockFreeStack s, int item) {
+    uint32_t index = allocIndex(s);
+    nodeAt(s, index)->data = item;
+    pushIndex(s, &s->top, index);
+    atomic_fetch_add_explicit(&s->size, 1, memory_order_relaxed);
+}
+
+// Pops an item from the stack into *item
+bool LockFreeStackTryPop(LockFreeStack s, int *item) {
+    uint32_t index = popIndex(s, &s->top);
+    if (index == 0) return false;
+    *item = nodeAt(s, index)->data;
+    atomic_fetch_sub_explicit(&s->size, 1, memory_order_relaxed);
+    pushIndex(s, &s->free, index);
+    return true;
+}
+
+// Pops an item from the stack and returns it
+// Assumes that the stack is not empty
+int LockFreeStackPop(LockFreeStack s) {
+    int item;
+    if (!LockFreeStackTryPop(s, &item)) {
+        fprintf(stderr, "Stack is empty\n");
+        exit(1);
+    }
+    return item;
+}
+
+// Returns the number of items on the stack
+int LockFreeStackSize(LockFreeStack s) {
+    int size = atomic_load_explicit(&s->size, memory_order_relaxed);
+    return (size < 0) ? 0 : size;
+}
+
+// Returns whether the stack is empty
+bool LockFreeStackIsEmpty(LockFreeStack s) {
+    if ((uint32_t)atomic_load(&s->top) == 0) return true;
+    return false;
+}
+
+// Frees the stack
+void LockFreeStackFree(LockFreeStack s) {
+    for (int i = 0; i < MAX_CHUNKS; i++) {
+        free(atomic_load(&s->chunks[i]));
+    }
+    free(s);
+}
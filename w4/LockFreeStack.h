@@ -0,0 +1,34 @@
+#ifndef LOCK_FREE_STACK_H
+#define LOCK_FREE_STACK_H
+#include <stdbool.h>
+
+// A stack that any number of threads can push to and pop from at the
+// same time, without locks
+typedef struct lockFreeStack *LockFreeStack;
+
+// Creates a new empty stack
+LockFreeStack LockFreeStackNew(void);
+
+// Pushes an item onto the stack
+void LockFreeStackPush(LockFreeStack s, int item);
+
+// Pops an item from the stack into *item
+// Returns false if the stack is empty
+bool LockFreeStackTryPop(LockFreeStack s, int *item);
+
+// Pops an item from the stack and returns it
+// Assumes that the stack is not empty
+int LockFreeStackPop(LockFreeStack s);
+
+// Returns the number of items on the stack
+// Only a snapshot while other threads are running
+int LockFreeStackSize(LockFreeStack s);
+
+// Returns whether the stack is empty
+bool LockFreeStackIsEmpty(LockFreeStack s);
+
+// Frees the stack
+// No other thread may be using it
+void LockFreeStackFree(LockFreeStack s);
+
+#endif // LOCK_FREE_STACK_H
@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+
+#include "MpmcQueue.h"
+
+#define CACHE_LINE 64
+
+// Each slot carries a sequence number that says whose turn it is (after
+// Dmitry Vyukov's bounded MPMC queue). For the slot at position pos:
+//   sequence == pos           the slot is free for the producer of pos
+//   sequence == pos + 1       the slot holds an item for the consumer of pos
+//   sequence == pos + size    freed by the consumer, ready for the next lap
+// Threads claim a position with a CAS on enqueuePos or dequeuePos.
+struct cell {
+	atomic_size_t sequence;
+	int item;
+};
+
+struct mpmcQueue {
+	alignas(CACHE_LINE) atomic_size_t enqueuePos;
+	alignas(CACHE_LINE) atomic_size_t dequeuePos;
+	alignas(CACHE_LINE) struct cell *cells;
+	size_t mask;
+};
+
+MpmcQueue MpmcQueueNew(int capacity) {
+	size_t size = 2;
+	while (size < (size_t)capacity) size *= 2;
+
+	MpmcQueue q = aligned_alloc(CACHE_LINE, sizeof(struct mpmcQueue));
+	if (q == NULL) {
+		fprintf(stderr, "Memory allocation failed\n");
+		exit(1);
+	}
+	q->cells = malloc(size * sizeof(struct cell));
+	if (q->cells == NULL) {
+		fprintf(stderr, "Memory allocation failed\n");
+		exit(1);
+	}
+	for (size_t i = 0; i < size; i++) {
+		atomic_init(&q->cells[i].sequence, i);
+	}
+	q->mask = size - 1;
+	atomic_init(&q->enqueuePos, 0);
+	atomic_init(&q->dequeuePos, 0);
+	return q;
+}
+
+bool MpmcQueueEnqueue(MpmcQueue q, int item) {
+	size_t pos = atomic_load_explicit(&q->enqueuePos, memory_order_relaxed);
+	struct cell *cell;
+	for (;;) {
+		cell = &q->cells[pos & q->mask];
+		size_t seq = atomic_load_explicit(&cell->sequence,
+		                                  memory_order_acquire);
+		intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+		if (diff == 0) {
+			if (atomic_compare_exchange_weak_explicit(&q->enqueuePos,
+			        &pos, pos + 1,
+			        memory_order_relaxed, memory_order_relaxed)) {
+				break;
+			}
+		} else if (diff < 0) {
+			return false;
+		} else {
+			pos = atomic_load_explicit(&q->enqueuePos, memory_order_relaxed);
+		}
+	}
+	cell->item = item;
+	atomic_store_explicit(&cell->sequence, pos + 1, memory_order_release);
+	return true;
+}
+
+bool MpmcQueueDequeue(MpmcQueue q, int *item) {
+	size_t pos = atomic_load_explicit(&q->dequeuePos, memory_order_relaxed);
+	struct cell *cell;
+	for (;;) {
+		cell = &q->cells[pos & q->mask];
+		size_t seq = atomic_load_explicit(&cell->sequence,
+		                                  memory_order_acquire);
+		intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+		if (diff == 0) {
+			if (atomic_compare_exchange_weak_explicit(&q->dequeuePos,
+			        &pos, pos + 1,
+			        memory_order_relaxed, memory_order_relaxed)) {
+				break;
+			}
+		} else if (diff < 0) {
+			return false;
+		} else {
+			pos = atomic_load_explicit(&q->dequeuePos, memory_order_relaxed);
+		}
+	}
+	*item = cell->item;
+	atomic_store_explicit(&cell->sequence, pos + q->mask + 1,
+	                      memory_order_release);
+	return true;
+}
+
+int MpmcQueueSize(MpmcQueue q) {
+	size_t head = atomic_load_explicit(&q->dequeuePos, memory_order_acquire);
+	size_t tail = atomic_load_explicit(&q->enqueuePos, memory_order_acquire);
+	if (tail < head) return 0;
+	return (int)(tail - head);
+}
+
+bool MpmcQueueIsEmpty(MpmcQueue q) {
+	if (MpmcQueueSize(q) == 0) return true;
+	return false;
+}
+
+void MpmcQueueFree(MpmcQueue q) {
+	free(q->cells);
+	free(q);
+}
@@ -0,0 +1,31 @@
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#include <stdbool.h>
+
+// A bounded queue that any number of producer and consumer threads can
+// use at the same time, without locks
+typedef struct mpmcQueue *MpmcQueue;
+
+// Creates a new empty queue that holds at least capacity items
+MpmcQueue MpmcQueueNew(int capacity);
+
+// Enqueues an item into the queue
+// Returns false, without enqueuing, if the queue is full
+bool MpmcQueueEnqueue(MpmcQueue q, int item);
+
+// Dequeues an item from the queue into *item
+// Returns false if the queue is empty
+bool MpmcQueueDequeue(MpmcQueue q, int *item);
+
+// Returns the number of items in the queue
+// Only a snapshot while other threads are running
+int MpmcQueueSize(MpmcQueue q);
+
+// Returns whether a queue is empty
+bool MpmcQueueIsEmpty(MpmcQueue q);
+
+// Frees the queue
+void MpmcQueueFree(MpmcQueue q);
+
+#endif // MPMC_QUEUE_H
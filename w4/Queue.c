@@ -1,42 +1,121 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "Queue.h"
-#include "Stack.h"
+
+// Must be a power of two so indices wrap with a mask
+#define INITIAL_CAPACITY 16
 
 struct queue {
-	Stack s1;
-	Stack s2;
+	int *items;     // circular buffer
+	int capacity;   // always a power of two
+	int head;       // index of the front item
+	int size;       // number of items in the queue
 };
 
+// Copies n items out of the ring starting at index from into dest
+static void copyOut(Queue q, int from, int *dest, int n) {
+	int first = q->capacity - from;
+	if (first > n) first = n;
+	memcpy(dest, q->items + from, first * sizeof(int));
+	memcpy(dest + first, q->items, (n - first) * sizeof(int));
+}
+
+// Copies n items from src into the ring starting at index to
+static void copyIn(Queue q, int to, int *src, int n) {
+	int first = q->capacity - to;
+	if (first > n) first = n;
+	memcpy(q->items + to, src, first * sizeof(int));
+	memcpy(q->items, src + first, (n - first) * sizeof(int));
+}
+
+// Grows the buffer until it can hold at least needed items, unwrapping
+// the contents so the front is at index 0
+static void grow(Queue q, int needed) {
+	int capacity = q->capacity;
+	while (capacity < needed) capacity *= 2;
+	int *items = malloc(capacity * sizeof(int));
+	if (items == NULL) {
+		fprintf(stderr, "Memory allocation failed\n");
+		exit(1);
+	}
+	copyOut(q, q->head, items, q->size);
+	free(q->items);
+	q->items = items;
+	q->capacity = capacity;
+	q->head = 0;
+}
+
 Queue QueueNew(void) {
 	Queue q = malloc(sizeof(struct queue));
-	q->s1 = StackNew();
-	q->s2 = StackNew();
+	if (q == NULL) {
+		fprintf(stderr, "Memory allocation failed\n");
+		exit(1);
+	}
+	q->items = malloc(INITIAL_CAPACITY * sizeof(int));
+	if (q->items == NULL) {
+		fprintf(stderr, "Memory allocation failed\n");
+		exit(1);
+	}
+	q->capacity = INITIAL_CAPACITY;
+	q->head = 0;
+	q->size = 0;
 	return q;
 }
 
 void QueueEnqueue(Queue q, int item) {
-    StackPush(q->s1, item);
+	if (q->size == q->capacity) grow(q, q->size + 1);
+	q->items[(q->head + q->size) & (q->capacity - 1)] = item;
+	q->size++;
+}
+
+void QueueEnqueueN(Queue q, int items[], int n) {
+	if (n <= 0) return;
+	if (q->size + n > q->capacity) grow(q, q->size + n);
+	copyIn(q, (q->head + q->size) & (q->capacity - 1), items, n);
+	q->size += n;
 }
 
 int QueueDequeue(Queue q) {
-    if (StackIsEmpty(q->s2)) {
-        while (!StackIsEmpty(q->s1)) {
-            int item = StackPop(q->s1);
-            StackPush(q->s2, item);
-        }
-    }
-    return StackPop(q->s2);
+	if (q->size == 0) {
+		fprintf(stderr, "Queue is empty\n");
+		exit(1);
+	}
+	int item = q->items[q->head];
+	q->head = (q->head + 1) & (q->capacity - 1);
+	q->size--;
+	return item;
 }
+
+int QueueDequeueN(Queue q, int items[], int n) {
+	if (n > q->size) n = q->size;
+	if (n <= 0) return 0;
+	copyOut(q, q->head, items, n);
+	q->head = (q->head + n) & (q->capacity - 1);
+	q->size -= n;
+	return n;
+}
+
+int QueuePeek(Queue q) {
+	if (q->size == 0) {
+		fprintf(stderr, "Queue is empty\n");
+		exit(1);
+	}
+	return q->items[q->head];
+}
+
+int QueueSize(Queue q) {
+	return q->size;
+}
+
 bool QueueIsEmpty(Queue q) {
-    if (StackIsEmpty(q->s1) && StackIsEmpty(q->s2)) return true;
-    return false;
+	if (q->size == 0) return true;
+	return false;
 }
 
 void QueueFree(Queue q) {
-    StackFree(q->s1);
-    StackFree(q->s2);
-    free(q);
-}
\ No newline at end of file
+	free(q->items);
+	free(q);
+}
@@ -1,7 +1,6 @@
 #ifndef QUEUE_H
 #define QUEUE_H
 
-#include "Stack.h"
 #include <stdbool.h>
 
 typedef struct queue *Queue;
@@ -12,10 +11,23 @@ Queue QueueNew(void);
 // Enqueues an item into the queue
 void QueueEnqueue(Queue q, int item);
 
+// Enqueues items[0..n-1] into the queue, in order
+void QueueEnqueueN(Queue q, int items[], int n);
+
 // Dequeues an item from the queue and returns it
 // Assumes that the queue is not empty
 int QueueDequeue(Queue q);
 
+// Dequeues up to n items into items[] and returns how many were dequeued
+int QueueDequeueN(Queue q, int items[], int n);
+
+// Returns the item at the front of the queue without removing it
+// Assumes that the queue is not empty
+int QueuePeek(Queue q);
+
+// Returns the number of items in the queue
+int QueueSize(Queue q);
+
 // Returns whether a queue is empty
 bool QueueIsEmpty(Queue q);
 
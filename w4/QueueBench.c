@@ -0,0 +1,146 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#include "SpscQueue.h"
+#include "MpmcQueue.h"
+
+// -----------------------------------------------------------------------------
+// Multi-threaded throughput benchmark for SpscQueue and MpmcQueue.
+//
+// Usage: ./QueueBench [items] [maxThreads]
+// Every item is an int handed from a producer to a consumer; the consumers'
+// checksums are compared with the producers' to catch lost or duplicated
+// items. Full and empty queues are retried after sched_yield() so the
+// benchmark still makes progress when there are fewer cores than threads.
+// -----------------------------------------------------------------------------
+
+#define QUEUE_CAPACITY 1024
+
+struct spscArgs {
+    SpscQueue q;
+    long items;
+    long long sum;
+};
+
+struct mpmcArgs {
+    MpmcQueue q;
+    long items;             // items this thread produces or consumes
+    long long sum;
+};
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void *spscProducer(void *arg) {
+    struct spscArgs *a = arg;
+    for (long i = 0; i < a->items; i++) {
+        while (!SpscQueueEnqueue(a->q, (int)i)) sched_yield();
+    }
+    return NULL;
+}
+
+static void *spscConsumer(void *arg) {
+    struct spscArgs *a = arg;
+    int item;
+    for (long i = 0; i < a->items; i++) {
+        while (!SpscQueueDequeue(a->q, &item)) sched_yield();
+        a->sum += item;
+    }
+    return NULL;
+}
+
+static void *mpmcProducer(void *arg) {
+    struct mpmcArgs *a = arg;
+    for (long i = 0; i < a->items; i++) {
+        while (!MpmcQueueEnqueue(a->q, (int)i)) sched_yield();
+        a->sum += (int)i;
+    }
+    return NULL;
+}
+
+static void *mpmcConsumer(void *arg) {
+    struct mpmcArgs *a = arg;
+    int item;
+    for (long i = 0; i < a->items; i++) {
+        while (!MpmcQueueDequeue(a->q, &item)) sched_yield();
+        a->sum += item;
+    }
+    return NULL;
+}
+
+static void benchSpsc(long items) {
+    SpscQueue q = SpscQueueNew(QUEUE_CAPACITY);
+    struct spscArgs prod = { q, items, 0 };
+    struct spscArgs cons = { q, items, 0 };
+    pthread_t p, c;
+
+    double start = now();
+    pthread_create(&p, NULL, spscProducer, &prod);
+    pthread_create(&c, NULL, spscConsumer, &cons);
+    pthread_join(p, NULL);
+    pthread_join(c, NULL);
+    double secs = now() - start;
+
+    long long expected = (long long)items * (items - 1) / 2;
+    printf("SPSC  1P/ 1C  %8.2f Mops/s  %s\n", items / secs / 1e6,
+           cons.sum == expected ? "ok" : "CHECKSUM MISMATCH");
+    SpscQueueFree(q);
+}
+
+static void benchMpmc(long items, int threads) {
+    MpmcQueue q = MpmcQueueNew(QUEUE_CAPACITY);
+    struct mpmcArgs *prod = calloc(threads, sizeof *prod);
+    struct mpmcArgs *cons = calloc(threads, sizeof *cons);
+    pthread_t *tids = malloc(2 * threads * sizeof *tids);
+    if (prod == NULL || cons == NULL || tids == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+
+    long perThread = items / threads;
+    double start = now();
+    for (int i = 0; i < threads; i++) {
+        prod[i] = (struct mpmcArgs){ q, perThread, 0 };
+        cons[i] = (struct mpmcArgs){ q, perThread, 0 };
+        pthread_create(&tids[i], NULL, mpmcProducer, &prod[i]);
+        pthread_create(&tids[threads + i], NULL, mpmcConsumer, &cons[i]);
+    }
+    for (int i = 0; i < 2 * threads; i++) {
+        pthread_join(tids[i], NULL);
+    }
+    double secs = now() - start;
+
+    long long produced = 0, consumed = 0;
+    for (int i = 0; i < threads; i++) {
+        produced += prod[i].sum;
+        consumed += cons[i].sum;
+    }
+    printf("MPMC %2dP/%2dC  %8.2f Mops/s  %s\n", threads, threads,
+           perThread * threads / secs / 1e6,
+           produced == consumed ? "ok" : "CHECKSUM MISMATCH");
+
+    free(tids);
+    free(cons);
+    free(prod);
+    MpmcQueueFree(q);
+}
+
+int main(int argc, char *argv[]) {
+    long items = (argc > 1) ? atol(argv[1]) : 10000000;
+    int maxThreads = (argc > 2) ? atoi(argv[2]) : 8;
+
+    printf("%ld items, queue capacity %d\n", items, QUEUE_CAPACITY);
+    benchSpsc(items);
+    for (int t = 1; t <= maxThreads; t *= 2) {
+        benchMpmc(items, t);
+    }
+    return 0;
+}
@@ -2,7 +2,11 @@
 #include <stdlib.h>
 #include <stdbool.h>
 
+#include <pthread.h>
+
 #include "Queue.h"
+#include "SpscQueue.h"
+#include "MpmcQueue.h"
 
 // ANSI colour codes
 #define RESET   "\033[0m"
@@ -133,6 +137,188 @@ static void test_large_queue(void) {
     QueueFree(q);
 }
 
+// Test 6: Wrap-around Growth
+// Grow the queue while its contents wrap past the end of the buffer.
+static void test_wraparound_growth(void) {
+    print_test_suite_header("Wrap-around Growth");
+    Queue q = QueueNew();
+    int next_in = 0, next_out = 0;
+    bool condition = true;
+
+    // Leave the front part-way through the buffer, then keep growing.
+    for (int round = 0; round < 10; round++) {
+        for (int i = 0; i < 7 * (round + 1); i++) {
+            QueueEnqueue(q, next_in++);
+        }
+        for (int i = 0; i < 3 * (round + 1); i++) {
+            if (QueueDequeue(q) != next_out++) condition = false;
+        }
+    }
+    while (!QueueIsEmpty(q)) {
+        if (QueueDequeue(q) != next_out++) condition = false;
+    }
+    condition = condition && next_in == next_out;
+    run_test("FIFO order kept across wrap-around and growth", condition);
+    QueueFree(q);
+}
+
+// Test 7: Size and Peek
+// Peek returns the front without removing it; size tracks the contents.
+static void test_size_and_peek(void) {
+    print_test_suite_header("Size and Peek");
+    Queue q = QueueNew();
+    QueueEnqueue(q, 5);
+    QueueEnqueue(q, 6);
+    bool condition = (QueueSize(q) == 2 && QueuePeek(q) == 5
+                      && QueueSize(q) == 2);
+    QueueDequeue(q);
+    condition = condition && QueuePeek(q) == 6 && QueueSize(q) == 1;
+    run_test("Peek leaves the front in place and size is tracked", condition);
+    QueueFree(q);
+}
+
+// Test 8: Bulk Enqueue and Dequeue
+// Enqueue and dequeue whole arrays, including a short final dequeue.
+static void test_bulk_operations(void) {
+    print_test_suite_header("Bulk Operations");
+    Queue q = QueueNew();
+    int in[100];
+    for (int i = 0; i < 100; i++) in[i] = i;
+
+    QueueEnqueue(q, -1);
+    QueueEnqueueN(q, in, 100);
+    bool condition = (QueueSize(q) == 101 && QueueDequeue(q) == -1);
+
+    int out[100];
+    int got = QueueDequeueN(q, out, 60);
+    QueueEnqueueN(q, in, 30);
+    got += QueueDequeueN(q, out + 60, 40);
+    for (int i = 0; i < 100; i++) {
+        if (out[i] != i) condition = false;
+    }
+    int rest[64];
+    int last = QueueDequeueN(q, rest, 64);
+    condition = condition && got == 100 && last == 30 && rest[29] == 29
+                && QueueIsEmpty(q) && QueueDequeueN(q, rest, 64) == 0;
+    run_test("Bulk enqueue and dequeue keep FIFO order", condition);
+    QueueFree(q);
+}
+
+// -----------------------------------------------------------------------------
+// Test Cases for SpscQueue and MpmcQueue
+// -----------------------------------------------------------------------------
+
+#define TRANSFER_ITEMS 200000
+
+// Test 9: Bounded SPSC Queue
+// FIFO order, and enqueue refuses items once the capacity is reached.
+static void test_spsc_bounded(void) {
+    print_test_suite_header("SPSC Bounded");
+    SpscQueue q = SpscQueueNew(4);
+    bool condition = SpscQueueIsEmpty(q);
+    for (int i = 0; i < 4; i++) {
+        condition = condition && SpscQueueEnqueue(q, i);
+    }
+    condition = condition && !SpscQueueEnqueue(q, 4) && SpscQueueSize(q) == 4;
+    int item;
+    for (int i = 0; i < 4; i++) {
+        condition = condition && SpscQueueDequeue(q, &item) && item == i;
+    }
+    condition = condition && !SpscQueueDequeue(q, &item);
+    run_test("SPSC FIFO order, full and empty detection", condition);
+    SpscQueueFree(q);
+}
+
+static void *spscProduce(void *arg) {
+    SpscQueue q = arg;
+    for (int i = 0; i < TRANSFER_ITEMS; i++) {
+        while (!SpscQueueEnqueue(q, i)) sched_yield();
+    }
+    return NULL;
+}
+
+// Test 10: SPSC Across Threads
+// Items handed from a producer thread arrive in order.
+static void test_spsc_threads(void) {
+    print_test_suite_header("SPSC Across Threads");
+    SpscQueue q = SpscQueueNew(64);
+    pthread_t producer;
+    pthread_create(&producer, NULL, spscProduce, q);
+    bool condition = true;
+    int item;
+    for (int i = 0; i < TRANSFER_ITEMS; i++) {
+        while (!SpscQueueDequeue(q, &item)) sched_yield();
+        if (item != i) condition = false;
+    }
+    pthread_join(producer, NULL);
+    run_test("SPSC order kept between two threads", condition);
+    SpscQueueFree(q);
+}
+
+// Test 11: Bounded MPMC Queue
+static void test_mpmc_bounded(void) {
+    print_test_suite_header("MPMC Bounded");
+    MpmcQueue q = MpmcQueueNew(4);
+    bool condition = MpmcQueueIsEmpty(q);
+    for (int i = 0; i < 4; i++) {
+        condition = condition && MpmcQueueEnqueue(q, i);
+    }
+    condition = condition && !MpmcQueueEnqueue(q, 4) && MpmcQueueSize(q) == 4;
+    int item;
+    for (int i = 0; i < 4; i++) {
+        condition = condition && MpmcQueueDequeue(q, &item) && item == i;
+    }
+    condition = condition && !MpmcQueueDequeue(q, &item);
+    run_test("MPMC FIFO order, full and empty detection", condition);
+    MpmcQueueFree(q);
+}
+
+struct mpmcWorker {
+    MpmcQueue q;
+    long long sum;
+};
+
+static void *mpmcProduce(void *arg) {
+    struct mpmcWorker *w = arg;
+    for (int i = 0; i < TRANSFER_ITEMS; i++) {
+        while (!MpmcQueueEnqueue(w->q, i)) sched_yield();
+        w->sum += i;
+    }
+    return NULL;
+}
+
+static void *mpmcConsume(void *arg) {
+    struct mpmcWorker *w = arg;
+    int item;
+    for (int i = 0; i < TRANSFER_ITEMS; i++) {
+        while (!MpmcQueueDequeue(w->q, &item)) sched_yield();
+        w->sum += item;
+    }
+    return NULL;
+}
+
+// Test 12: MPMC Across Threads
+// Two producers and two consumers; nothing is lost or duplicated.
+static void test_mpmc_threads(void) {
+    print_test_suite_header("MPMC Across Threads");
+    MpmcQueue q = MpmcQueueNew(64);
+    struct mpmcWorker workers[4] = { {q, 0}, {q, 0}, {q, 0}, {q, 0} };
+    pthread_t threads[4];
+    for (int i = 0; i < 4; i++) {
+        pthread_create(&threads[i], NULL, (i < 2) ? mpmcProduce : mpmcConsume,
+                       &workers[i]);
+    }
+    for (int i = 0; i < 4; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    bool condition = (workers[0].sum + workers[1].sum
+                      == workers[2].sum + workers[3].sum)
+                     && MpmcQueueIsEmpty(q);
+    run_test("MPMC checksum matches across 2 producers and 2 consumers",
+             condition);
+    MpmcQueueFree(q);
+}
+
 // -----------------------------------------------------------------------------
 // Run All Tests
 // -----------------------------------------------------------------------------
@@ -142,6 +328,13 @@ static void run_tests(void) {
     test_multiple_enqueue_dequeue();
     test_interleaved_operations();
     test_large_queue();
+    test_wraparound_growth();
+    test_size_and_peek();
+    test_bulk_operations();
+    test_spsc_bounded();
+    test_spsc_threads();
+    test_mpmc_bounded();
+    test_mpmc_threads();
 }
 
 // -----------------------------------------------------------------------------
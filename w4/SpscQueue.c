@@ -0,0 +1,82 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+
+#include "SpscQueue.h"
+
+#define CACHE_LINE 64
+
+// head and tail live on separate cache lines so the producer and consumer
+// never write to the same line. Each side also keeps a cached copy of the
+// other side's index and only re-reads it when the cached one says the
+// queue looks full (or empty).
+struct spscQueue {
+	alignas(CACHE_LINE) atomic_size_t head;   // next slot to read
+	size_t cachedTail;                         // consumer's view of tail
+	alignas(CACHE_LINE) atomic_size_t tail;   // next slot to write
+	size_t cachedHead;                         // producer's view of head
+	alignas(CACHE_LINE) int *items;
+	size_t mask;
+};
+
+SpscQueue SpscQueueNew(int capacity) {
+	size_t size = 1;
+	while (size < (size_t)capacity) size *= 2;
+
+	SpscQueue q = aligned_alloc(CACHE_LINE, sizeof(struct spscQueue));
+	if (q == NULL) {
+		fprintf(stderr, "Memory allocation failed\n");
+		exit(1);
+	}
+	q->items = malloc(size * sizeof(int));
+	if (q->items == NULL) {
+		fprintf(stderr, "Memory allocation failed\n");
+		exit(1);
+	}
+	q->mask = size - 1;
+	atomic_init(&q->head, 0);
+	atomic_init(&q->tail, 0);
+	q->cachedHead = 0;
+	q->cachedTail = 0;
+	return q;
+}
+
+bool SpscQueueEnqueue(SpscQueue q, int item) {
+	size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+	if (tail - q->cachedHead > q->mask) {
+		q->cachedHead = atomic_load_explicit(&q->head, memory_order_acquire);
+		if (tail - q->cachedHead > q->mask) return false;
+	}
+	q->items[tail & q->mask] = item;
+	atomic_store_explicit(&q->tail, tail + 1, memory_order_release);
+	return true;
+}
+
+bool SpscQueueDequeue(SpscQueue q, int *item) {
+	size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+	if (head == q->cachedTail) {
+		q->cachedTail = atomic_load_explicit(&q->tail, memory_order_acquire);
+		if (head == q->cachedTail) return false;
+	}
+	*item = q->items[head & q->mask];
+	atomic_store_explicit(&q->head, head + 1, memory_order_release);
+	return true;
+}
+
+int SpscQueueSize(SpscQueue q) {
+	size_t head = atomic_load_explicit(&q->head, memory_order_acquire);
+	size_t tail = atomic_load_explicit(&q->tail, memory_order_acquire);
+	return (int)(tail - head);
+}
+
+bool SpscQueueIsEmpty(SpscQueue q) {
+	if (SpscQueueSize(q) == 0) return true;
+	return false;
+}
+
+void SpscQueueFree(SpscQueue q) {
+	free(q->items);
+	free(q);
+}
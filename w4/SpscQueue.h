@@ -0,0 +1,31 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <stdbool.h>
+
+// A bounded queue that is safe for exactly one producer thread and one
+// consumer thread to use at the same time, without locks
+typedef struct spscQueue *SpscQueue;
+
+// Creates a new empty queue that holds at least capacity items
+SpscQueue SpscQueueNew(int capacity);
+
+// Enqueues an item into the queue (producer only)
+// Returns false, without enqueuing, if the queue is full
+bool SpscQueueEnqueue(SpscQueue q, int item);
+
+// Dequeues an item from the queue into *item (consumer only)
+// Returns false if the queue is empty
+bool SpscQueueDequeue(SpscQueue q, int *item);
+
+// Returns the number of items in the queue
+// Only a snapshot while the other thread is running
+int SpscQueueSize(SpscQueue q);
+
+// Returns whether a queue is empty
+bool SpscQueueIsEmpty(SpscQueue q);
+
+// Frees the queue
+void SpscQueueFree(SpscQueue q);
+
+#endif // SPSC_QUEUE_H
@@ -3,21 +3,42 @@
 #include <stdbool.h>
 #include "Stack.h"
 
-// Definition of the node structure
-struct node {
-    int data;
-    struct node *next;
+// Number of items stored in each block
+#define BLOCK_SIZE 512
+
+// Definition of the block structure: a fixed array of items, linked to
+// the (full) block below it
+struct block {
+    int items[BLOCK_SIZE];
+    struct block *below;
 };
 
 // Definition of the stack structure
 struct stack {
-    struct node *top;
+    struct block *top;     // block holding the top item
+    int topCount;          // number of items used in the top block
+    struct block *spare;   // emptied block kept for the next push
     int size;
 };
 
-typedef struct node* Node;
+typedef struct block* Block;
 typedef struct stack* Stack;
 
+// Takes the spare block if there is one, otherwise allocates a block
+static Block newBlock(Stack s) {
+    Block b = s->spare;
+    if (b != NULL) {
+        s->spare = NULL;
+        return b;
+    }
+    b = malloc(sizeof(struct block));
+    if (b == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    return b;
+}
+
 // Creates a new empty stack
 Stack StackNew(void) {
     Stack s = malloc(sizeof(struct stack));
@@ -26,35 +47,42 @@ Stack StackNew(void) {
         exit(1);
     }
     s->top = NULL;
+    s->topCount = 0;
+    s->spare = NULL;
     s->size = 0;
     return s;
 }
 
 // Pushes an item onto the stack
 void StackPush(Stack s, int item) {
-    Node newNode = malloc(sizeof(struct node));
-    if (newNode == NULL) {
-        fprintf(stderr, "Memory allocation failed\n");
-        exit(1);
+    if (s->top == NULL || s->topCount == BLOCK_SIZE) {
+        Block b = newBlock(s);
+        b->below = s->top;
+        s->top = b;
+        s->topCount = 0;
     }
-    newNode->data = item;
-    newNode->next = s->top;
-    s->top = newNode;
+    s->top->items[s->topCount++] = item;
     s->size++;
 }
 
 // Pops an item from the stack and returns it
 // Assumes that the stack is not empty
 int StackPop(Stack s) {
-    if (s->top == NULL) {
+    if (s->size == 0) {
         fprintf(stderr, "Stack is empty\n");
         exit(1);
     }
-    Node temp = s->top;
-    int poppedItem = temp->data;
-    s->top = s->top->next;
-    free(temp);
+    int poppedItem = s->top->items[--s->topCount];
     s->size--;
+    if (s->topCount == 0) {
+        // Keep the emptied block as the spare so that pushing and popping
+        // across a block boundary does not malloc and free every time
+        Block empty = s->top;
+        s->top = empty->below;
+        s->topCount = (s->top != NULL) ? BLOCK_SIZE : 0;
+        free(s->spare);
+        s->spare = empty;
+    }
     return poppedItem;
 }
 
@@ -72,9 +100,10 @@ bool StackIsEmpty(Stack s) {
 // Frees the stack
 void StackFree(Stack s) {
     while (s->top != NULL) {
-        Node temp = s->top;
-        s->top = s->top->next;
+        Block temp = s->top;
+        s->top = s->top->below;
         free(temp);
     }
+    free(s->spare);
     free(s);
 }
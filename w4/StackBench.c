@@ -0,0 +1,122 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "Stack.h"
+#include "LockFreeStack.h"
+
+// -----------------------------------------------------------------------------
+// Contention benchmark: LockFreeStack against Stack behind a mutex.
+//
+// Usage: ./StackBench [totalOps] [maxThreads]
+// The threads split totalOps push/pop pairs on one shared stack. The
+// thread count doubles from 1 up to maxThreads (64 by default).
+// Throughput is total pairs per second; pop failures would mean a lost
+// item.
+// -----------------------------------------------------------------------------
+
+#define PREFILL 1024
+
+struct lockedStack {
+    pthread_mutex_t lock;
+    Stack s;
+};
+
+struct args {
+    void *stack;
+    long ops;
+    long failures;
+};
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void *runLockFree(void *arg) {
+    struct args *a = arg;
+    LockFreeStack s = a->stack;
+    int item;
+    for (long i = 0; i < a->ops; i++) {
+        LockFreeStackPush(s, (int)i);
+        if (!LockFreeStackTryPop(s, &item)) a->failures++;
+    }
+    return NULL;
+}
+
+static void *runLocked(void *arg) {
+    struct args *a = arg;
+    struct lockedStack *ls = a->stack;
+    for (long i = 0; i < a->ops; i++) {
+        pthread_mutex_lock(&ls->lock);
+        StackPush(ls->s, (int)i);
+        pthread_mutex_unlock(&ls->lock);
+
+        pthread_mutex_lock(&ls->lock);
+        if (StackIsEmpty(ls->s)) a->failures++;
+        else StackPop(ls->s);
+        pthread_mutex_unlock(&ls->lock);
+    }
+    return NULL;
+}
+
+// Runs fn on threads threads and returns millions of push/pop pairs per second
+static double run(void *(*fn)(void *), void *stack, int threads, long ops,
+                  long *failures) {
+    pthread_t *tids = malloc(threads * sizeof *tids);
+    struct args *args = malloc(threads * sizeof *args);
+    if (tids == NULL || args == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    double start = now();
+    for (int i = 0; i < threads; i++) {
+        args[i] = (struct args){ stack, ops, 0 };
+        pthread_create(&tids[i], NULL, fn, &args[i]);
+    }
+    *failures = 0;
+    for (int i = 0; i < threads; i++) {
+        pthread_join(tids[i], NULL);
+        *failures += args[i].failures;
+    }
+    double secs = now() - start;
+    free(args);
+    free(tids);
+    return threads * ops / secs / 1e6;
+}
+
+int main(int argc, char *argv[]) {
+    long ops = (argc > 1) ? atol(argv[1]) : 1000000;
+    int maxThreads = (argc > 2) ? atoi(argv[2]) : 64;
+
+    printf("%ld push/pop pairs in total\n", ops);
+    printf("threads  lock-free Mops/s  mutex Mops/s\n");
+    for (int t = 1; t <= maxThreads; t *= 2) {
+        LockFreeStack lf = LockFreeStackNew();
+        struct lockedStack locked = { .s = StackNew() };
+        pthread_mutex_init(&locked.lock, NULL);
+        for (int i = 0; i < PREFILL; i++) {
+            LockFreeStackPush(lf, i);
+            StackPush(locked.s, i);
+        }
+
+        long lfFailures, lockedFailures;
+        double lfRate = run(runLockFree, lf, t, ops / t, &lfFailures);
+        double lockedRate = run(runLocked, &locked, t, ops / t,
+                                &lockedFailures);
+        bool ok = lfFailures == 0 && lockedFailures == 0
+                  && LockFreeStackSize(lf) == PREFILL
+                  && StackSize(locked.s) == PREFILL;
+        printf("%7d  %16.2f  %12.2f  %s\n", t, lfRate, lockedRate,
+               ok ? "ok" : "LOST ITEMS");
+
+        pthread_mutex_destroy(&locked.lock);
+        StackFree(locked.s);
+        LockFreeStackFree(lf);
+    }
+    return 0;
+}
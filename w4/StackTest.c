@@ -0,0 +1,196 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "Stack.h"
+#include "LockFreeStack.h"
+
+// ANSI colour codes
+#define RESET   "\033[0m"
+#define GREEN   "\033[32m"
+#define RED     "\033[31m"
+
+#define THREADS 4
+#define ITEMS_PER_THREAD 50000
+
+// -----------------------------------------------------------------------------
+// Test Suite Helper Functions
+// -----------------------------------------------------------------------------
+static void run_test(const char *test_name, bool condition) {
+    if (condition) {
+        printf("%sTest %s: PASSED%s\n", GREEN, test_name, RESET);
+    } else {
+        printf("%sTest %s: FAILED%s\n", RED, test_name, RESET);
+    }
+}
+
+static void print_test_suite_header(const char *suite_name) {
+    printf("\nTest Suite: %s\n", suite_name);
+    printf("-----------------------\n");
+}
+
+// -----------------------------------------------------------------------------
+// Test Cases for Stack
+// -----------------------------------------------------------------------------
+
+// Test 1: LIFO Order Across Blocks
+// Push enough items to span several blocks, then pop them all.
+static void test_stack_lifo(void) {
+    print_test_suite_header("Stack LIFO Order");
+    Stack s = StackNew();
+    bool condition = StackIsEmpty(s);
+    for (int i = 0; i < 5000; i++) {
+        StackPush(s, i);
+    }
+    condition = condition && StackSize(s) == 5000;
+    for (int i = 4999; i >= 0; i--) {
+        if (StackPop(s) != i) condition = false;
+    }
+    condition = condition && StackIsEmpty(s);
+    run_test("LIFO order kept across blocks", condition);
+    StackFree(s);
+}
+
+// Test 2: Block Boundary
+// Push and pop repeatedly across the boundary between two blocks.
+static void test_stack_boundary(void) {
+    print_test_suite_header("Stack Block Boundary");
+    Stack s = StackNew();
+    for (int i = 0; i < 512; i++) {
+        StackPush(s, i);
+    }
+    bool condition = true;
+    for (int i = 0; i < 1000; i++) {
+        StackPush(s, -i);
+        if (StackPop(s) != -i) condition = false;
+        if (StackPop(s) != 511) condition = false;
+        StackPush(s, 511);
+    }
+    condition = condition && StackSize(s) == 512;
+    run_test("Push and pop across a block boundary", condition);
+    StackFree(s);
+}
+
+// Test 3: Spare Block Reuse
+// Drain the stack to empty and refill it, so pushes take the spare block
+// with no block below it, and pop through several blocks so each newly
+// emptied block replaces the spare.
+static void test_stack_spare(void) {
+    print_test_suite_header("Stack Spare Block Reuse");
+    Stack s = StackNew();
+    bool condition = true;
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < 3 * 512 + 7; i++) {
+            StackPush(s, round * 10000 + i);
+        }
+        condition = condition && StackSize(s) == 3 * 512 + 7;
+        for (int i = 3 * 512 + 6; i >= 0; i--) {
+            if (StackPop(s) != round * 10000 + i) condition = false;
+        }
+        condition = condition && StackIsEmpty(s);
+    }
+    run_test("Refill after draining through several blocks", condition);
+
+    condition = true;
+    StackPush(s, 1);
+    condition = condition && StackPop(s) == 1 && StackIsEmpty(s);
+    for (int i = 0; i < 512; i++) {
+        StackPush(s, i);
+    }
+    StackPush(s, 512);
+    condition = condition && StackPop(s) == 512 && StackSize(s) == 512;
+    for (int i = 511; i >= 0; i--) {
+        if (StackPop(s) != i) condition = false;
+    }
+    condition = condition && StackIsEmpty(s);
+    run_test("Exactly full block and single item round trips", condition);
+    StackFree(s);
+}
+
+// -----------------------------------------------------------------------------
+// Test Cases for LockFreeStack
+// -----------------------------------------------------------------------------
+
+// Test 4: Single-threaded LIFO Order
+static void test_lockfree_lifo(void) {
+    print_test_suite_header("LockFreeStack LIFO Order");
+    LockFreeStack s = LockFreeStackNew();
+    int item;
+    bool condition = LockFreeStackIsEmpty(s) && !LockFreeStackTryPop(s, &item);
+    for (int i = 0; i < 10000; i++) {
+        LockFreeStackPush(s, i);
+    }
+    condition = condition && LockFreeStackSize(s) == 10000;
+    for (int i = 9999; i >= 0; i--) {
+        if (LockFreeStackPop(s) != i) condition = false;
+    }
+    condition = condition && LockFreeStackIsEmpty(s);
+    run_test("LIFO order and empty detection", condition);
+    LockFreeStackFree(s);
+}
+
+struct worker {
+    LockFreeStack s;
+    int id;
+    long long pushed;
+    long long popped;
+};
+
+static void *pushPop(void *arg) {
+    struct worker *w = arg;
+    int item;
+    for (int i = 0; i < ITEMS_PER_THREAD; i++) {
+        int value = w->id * ITEMS_PER_THREAD + i;
+        LockFreeStackPush(w->s, value);
+        w->pushed += value;
+        if (i % 3 != 0 && LockFreeStackTryPop(w->s, &item)) {
+            w->popped += item;
+        }
+    }
+    return NULL;
+}
+
+// Test 5: Concurrent Push and Pop
+// Every pushed item is popped exactly once, by a worker or afterwards.
+static void test_lockfree_threads(void) {
+    print_test_suite_header("LockFreeStack Across Threads");
+    LockFreeStack s = LockFreeStackNew();
+    struct worker workers[THREADS];
+    pthread_t threads[THREADS];
+    for (int i = 0; i < THREADS; i++) {
+        workers[i] = (struct worker){ s, i, 0, 0 };
+        pthread_create(&threads[i], NULL, pushPop, &workers[i]);
+    }
+    long long pushed = 0, popped = 0;
+    for (int i = 0; i < THREADS; i++) {
+        pthread_join(threads[i], NULL);
+        pushed += workers[i].pushed;
+        popped += workers[i].popped;
+    }
+    int item;
+    while (LockFreeStackTryPop(s, &item)) {
+        popped += item;
+    }
+    run_test("No items lost or duplicated", pushed == popped);
+    LockFreeStackFree(s);
+}
+
+// -----------------------------------------------------------------------------
+// Run All Tests
+// -----------------------------------------------------------------------------
+static void run_tests(void) {
+    test_stack_lifo();
+    test_stack_boundary();
+    test_stack_spare();
+    test_lockfree_lifo();
+    test_lockfree_threads();
+}
+
+// -----------------------------------------------------------------------------
+// Main Function
+// -----------------------------------------------------------------------------
+int main(void) {
+    run_tests();
+    return 0;
+}
@@ -0,0 +1,169 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "ThreadPool.h"
+#include "Deque.h"
+
+struct worker {
+    ThreadPool pool;
+    int id;
+    unsigned int seed;      // for picking steal victims
+    Deque deque;
+    pthread_t thread;
+};
+
+struct threadPool {
+    int size;
+    struct worker *workers; // workers[0] is whichever thread calls Run
+    atomic_bool active;     // a Run is in progress
+    atomic_bool stopping;   // ThreadPoolFree has been called
+    pthread_mutex_t lock;   // idle workers sleep on wake until active
+    pthread_cond_t wake;
+};
+
+// The worker the current thread is acting as, or NULL outside any pool
+static _Thread_local struct worker *self = NULL;
+
+static void runTask(struct task *t) {
+    t->fn(t->arg);
+    atomic_store_explicit(&t->done, true, memory_order_release);
+}
+
+// Tries to steal one task from a random other worker
+static struct task *stealTask(struct worker *w) {
+    ThreadPool p = w->pool;
+    if (p->size == 1) return NULL;
+    w->seed ^= w->seed << 13;
+    w->seed ^= w->seed >> 17;
+    w->seed ^= w->seed << 5;
+    int victim = w->seed % (p->size - 1);
+    if (victim >= w->id) victim++;
+    return DequeSteal(p->workers[victim].deque);
+}
+
+static void *workerLoop(void *arg) {
+    struct worker *w = arg;
+    ThreadPool p = w->pool;
+    self = w;
+    for (;;) {
+        if (!atomic_load_explicit(&p->active, memory_order_acquire)) {
+            pthread_mutex_lock(&p->lock);
+            while (!atomic_load(&p->active) && !atomic_load(&p->stopping)) {
+                pthread_cond_wait(&p->wake, &p->lock);
+            }
+            pthread_mutex_unlock(&p->lock);
+            if (atomic_load(&p->stopping)) return NULL;
+        }
+        struct task *t = DequePop(w->deque);
+        if (t == NULL) t = stealTask(w);
+        if (t != NULL) {
+            runTask(t);
+        } else {
+            sched_yield();
+        }
+    }
+}
+
+ThreadPool ThreadPoolNew(int nthreads) {
+    if (nthreads < 1) nthreads = 1;
+    ThreadPool p = malloc(sizeof(struct threadPool));
+    struct worker *workers = malloc(nthreads * sizeof(struct worker));
+    if (p == NULL || workers == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    p->size = nthreads;
+    p->workers = workers;
+    atomic_init(&p->active, false);
+    atomic_init(&p->stopping, false);
+    pthread_mutex_init(&p->lock, NULL);
+    pthread_cond_init(&p->wake, NULL);
+
+    for (int i = 0; i < nthreads; i++) {
+        workers[i].pool = p;
+        workers[i].id = i;
+        workers[i].seed = 2463534242u + i;
+        workers[i].deque = DequeNew();
+    }
+    for (int i = 1; i < nthreads; i++) {
+        if (pthread_create(&workers[i].thread, NULL, workerLoop,
+                           &workers[i]) != 0) {
+            fprintf(stderr, "Thread creation failed\n");
+            exit(1);
+        }
+    }
+    return p;
+}
+
+void ThreadPoolFree(ThreadPool p) {
+    pthread_mutex_lock(&p->lock);
+    atomic_store(&p->stopping, true);
+    atomic_store(&p->active, false);
+    pthread_cond_broadcast(&p->wake);
+    pthread_mutex_unlock(&p->lock);
+
+    for (int i = 1; i < p->size; i++) {
+        pthread_join(p->workers[i].thread, NULL);
+    }
+    for (int i = 0; i < p->size; i++) {
+        DequeFree(p->workers[i].deque);
+    }
+    pthread_cond_destroy(&p->wake);
+    pthread_mutex_destroy(&p->lock);
+    free(p->workers);
+    free(p);
+}
+
+int ThreadPoolSize(ThreadPool p) {
+    return p->size;
+}
+
+void ThreadPoolRun(ThreadPool p, void (*fn)(void *arg), void *arg) {
+    struct worker *saved = self;
+    self = &p->workers[0];
+
+    pthread_mutex_lock(&p->lock);
+    atomic_store(&p->active, true);
+    pthread_cond_broadcast(&p->wake);
+    pthread_mutex_unlock(&p->lock);
+
+    // Every task spawned below fn is joined before fn returns, so once it
+    // does the pool has no work left
+    fn(arg);
+
+    atomic_store(&p->active, false);
+    self = saved;
+}
+
+void ThreadPoolSpawn(ThreadPool p, struct task *t,
+                     void (*fn)(void *arg), void *arg) {
+    t->fn = fn;
+    t->arg = arg;
+    atomic_init(&t->done, false);
+    if (self == NULL || self->pool != p) {
+        runTask(t);
+        return;
+    }
+    DequePush(self->deque, t);
+}
+
+void ThreadPoolJoin(ThreadPool p, struct task *t) {
+    struct worker *w = self;
+    while (!atomic_load_explicit(&t->done, memory_order_acquire)) {
+        struct task *next = NULL;
+        if (w != NULL && w->pool == p) {
+            next = DequePop(w->deque);
+            if (next == NULL) next = stealTask(w);
+        }
+        if (next != NULL) {
+            runTask(next);
+        } else {
+            sched_yield();
+        }
+    }
+}
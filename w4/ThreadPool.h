@@ -0,0 +1,47 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stdatomic.h>
+
+// A fork-join pool of worker threads, each with its own work-stealing
+// Deque. Tasks are spawned and joined from inside other tasks, so that
+// recursive divide-and-conquer code can run in parallel:
+//
+//     struct task left;
+//     ThreadPoolSpawn(pool, &left, sumRange, &leftHalf);
+//     sumRange(&rightHalf);
+//     ThreadPoolJoin(pool, &left);
+typedef struct threadPool *ThreadPool;
+
+// A unit of work. Usually lives on the stack of the function that spawns
+// it, which must join it before returning.
+struct task {
+    void (*fn)(void *arg);
+    void *arg;
+    atomic_bool done;
+};
+
+// Creates a pool of nthreads workers; the thread that calls ThreadPoolRun
+// counts as one of them
+ThreadPool ThreadPoolNew(int nthreads);
+
+// Frees the pool and stops its threads
+void ThreadPoolFree(ThreadPool p);
+
+// Returns the number of workers in the pool
+int ThreadPoolSize(ThreadPool p);
+
+// Runs fn(arg) on the pool and returns once it has finished
+// Only one thread may call ThreadPoolRun on a pool at a time
+void ThreadPoolRun(ThreadPool p, void (*fn)(void *arg), void *arg);
+
+// Makes fn(arg) available for another worker to run, recording it in t
+// Called from inside a task; outside one, fn runs immediately
+void ThreadPoolSpawn(ThreadPool p, struct task *t,
+                     void (*fn)(void *arg), void *arg);
+
+// Waits until the spawned task t has finished, running other tasks
+// (including t itself, if no one has stolen it) in the meantime
+void ThreadPoolJoin(ThreadPool p, struct task *t);
+
+#endif // THREAD_POOL_H
@@ -15,6 +15,7 @@
  */
 
 #include <stdio.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 struct node {
@@ -22,45 +23,145 @@ struct node {
 	struct node *next;
 };
 
-static struct node *appendList(struct node *list, int data);
-static void printList(struct node *node);
-static void freeList(struct node *head);
+struct list {
+    struct node *head;
+    struct node *tail;
+    int length;
+    struct node *block;
+    int blockSize;
+};
+
+static struct list *newList(void);
+static struct list *listFromArray(int data[], int size);
+static struct node *newNode(int data);
+static void appendList(struct list *list, int data);
+static void prependList(struct list *list, int data);
+static int listLength(struct list *list);
+static void printList(struct list *list);
+static int inBlock(struct list *list, struct node *node);
+static void freeList(struct list *list);
 
 
 int main() {
-    struct node *head = NULL;
-    head = appendList(head, 1);
-    head = appendList(head, 2);
-    head = appendList(head, 3);
-    head = appendList(head, 4);
-    printList(head);
-    freeList(head);
+    struct list *list = newList();
+    appendList(list, 1);
+    appendList(list, 2);
+    appendList(list, 3);
+    appendList(list, 4);
+    printList(list);
+    freeList(list);
+
+    int data[] = {5, 6, 7};
+    list = listFromArray(data, 3);
+    appendList(list, 8);
+    prependList(list, 4);
+    printList(list);
+    printf("Length: %d\n", listLength(list));
+    freeList(list);
     return 0;
 }
 
-/** 
- * Function that creates a node and appends it to the end of a linked list
-*/
-static struct node *appendList(struct node *list, int data) {
-    struct node *newNode = malloc(sizeof(struct node));
-    newNode->data = data;
-    newNode->next = NULL;
+/**
+ * Function that creates an empty list
+ */
+static struct list *newList(void) {
+    struct list *list = malloc(sizeof(struct list));
     if (list == NULL) {
-        list = newNode;
-    } else {
-        struct node *lastNode = list;
-        while (lastNode->next != NULL) {
-            lastNode = lastNode->next;
-        }
-        lastNode->next = newNode;
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
     }
+    list->head = NULL;
+    list->tail = NULL;
+    list->length = 0;
+    list->block = NULL;
+    list->blockSize = 0;
     return list;
 }
 
+/**
+ * Function that creates a list of the given values, with all of its nodes
+ * in one allocation
+ */
+static struct list *listFromArray(int data[], int size) {
+    struct list *list = newList();
+    if (size == 0) {
+        return list;
+    }
+    list->block = malloc(size * sizeof(struct node));
+    if (list->block == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    list->blockSize = size;
+    for (int i = 0; i < size; i++) {
+        list->block[i].data = data[i];
+        list->block[i].next = &list->block[i + 1];
+    }
+    list->block[size - 1].next = NULL;
+    list->head = &list->block[0];
+    list->tail = &list->block[size - 1];
+    list->length = size;
+    return list;
+}
+
+/**
+ * Function that creates a node
+ */
+static struct node *newNode(int data) {
+    struct node *node = malloc(sizeof(struct node));
+    if (node == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(1);
+    }
+    node->data = data;
+    node->next = NULL;
+    return node;
+}
+
+/** 
+ * Function that appends a value to the end of a list in O(1), using the
+ * list's tail pointer
+ */
+static void appendList(struct list *list, int data) {
+    struct node *node = newNode(data);
+    if (list->head == NULL) {
+        list->head = node;
+    } else {
+        list->tail->next = node;
+    }
+    list->tail = node;
+    list->length++;
+}
+
+/**
+ * Function that adds a value to the front of a list
+ */
+static void prependList(struct list *list, int data) {
+    struct node *node = newNode(data);
+    node->next = list->head;
+    list->head = node;
+    if (list->tail == NULL) {
+        list->tail = node;
+    }
+    list->length++;
+}
+
+/**
+ * Function that returns the number of values in a list
+ */
+static int listLength(struct list *list) {
+    return list->length;
+}
+
 /**
  * Function that prints a linked list
  */
-static void printList(struct node *node) {
+static void printList(struct list *list) {
+    if (list->head == NULL) {
+        printf("Empty list\n");
+        return;
+    }
+    struct node *node = list->head;
     while (node->next != NULL) {
         printf("%d -> ", node->data);
         node = node->next;
@@ -68,17 +169,27 @@ static void printList(struct node *node) {
     printf("%d\n", node->data);
 }
 
+/**
+ * Function that checks whether a node was allocated by listFromArray
+ */
+static int inBlock(struct list *list, struct node *node) {
+    uintptr_t start = (uintptr_t)list->block;
+    uintptr_t end = (uintptr_t)(list->block + list->blockSize);
+    return (uintptr_t)node >= start && (uintptr_t)node < end;
+}
+
 /**
  * Function that free's memory of a linked list
  */
-static void freeList(struct node *head) {
-    if (head == NULL) {
-        return;
-    }
-    struct node *temp = head;
-    while (head != NULL) {
-        temp = head;
-        head = head->next;
-        free(temp);
+static void freeList(struct list *list) {
+    struct node *node = list->head;
+    while (node != NULL) {
+        struct node *temp = node;
+        node = node->next;
+        if (!inBlock(list, temp)) {
+            free(temp);
+        }
     }
+    free(list->block);
+    free(list);
 }
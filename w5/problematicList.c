@@ -6,6 +6,12 @@ struct Node {
     struct Node *next;
 };
 
+struct List {
+    struct Node *head;
+    struct Node *tail;
+    int length;
+};
+
 void freeList(struct Node *head) {
 	if (head == NULL) {
 	return;
@@ -26,31 +32,50 @@ void print_list(struct Node *node) {
     printf("%d\n", node->data);
     return;
 }
-struct Node *add(struct Node *a, int data) {
+void add(struct List *a, int data) {
     // malloc the node
     struct Node *newNode = (struct Node *)malloc(sizeof(struct Node));
     // set the node's data field
     newNode->data = data;
     // set the node's next field to NULL
     newNode->next = NULL;
-	if (a == NULL) {
-		a = newNode;
+	if (a->head == NULL) {
+		a->head = newNode;
 	} else {
-        struct Node *lastNode = a;
-        while (lastNode->next != NULL) {
-            lastNode = lastNode->next;
-        }
-        lastNode->next = newNode;
+        // add it after the tail
+        a->tail->next = newNode;
+	}
+	// the new node is the tail now
+	a->tail = newNode;
+	a->length = a->length + 1;
+	return;
+}
+void add_to_front(struct List *a, int data) {
+    // malloc the node
+    struct Node *newNode = (struct Node *)malloc(sizeof(struct Node));
+    newNode->data = data;
+    // the new node goes before the head
+    newNode->next = a->head;
+	if (a->head == NULL) {
+		a->tail = newNode;
 	}
-	return a;
+	a->head = newNode;
+	a->length = a->length + 1;
+	return;
+}
+int length(struct List *a) {
+    // return the length
+    return a->length;
 }
 int main() {
-	struct Node *head = NULL;
-	head = add(head, 1);
-	head = add(head, 2);
-	head = add(head, 3);
-	head = add(head, 4);
-	print_list(head);
-	freeList(head);
+	struct List l = {NULL, NULL, 0};
+	add(&l, 1);
+	add(&l, 2);
+	add(&l, 3);
+	add(&l, 4);
+	add_to_front(&l, 0);
+	print_list(l.head);
+	printf("Length: %d\n", length(&l));
+	freeList(l.head);
 	return 0;
 }
\ No newline at end of file